@@ -0,0 +1,36 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Bit-twiddling helpers shared by library modules. Not part of the
+ * public interface.
+ */
+
+#ifndef _OJ_BITOPS_H
+#define _OJ_BITOPS_H
+
+#include <stdint.h>
+
+#ifdef __GNUC__
+
+#define POPCOUNT64(x) __builtin_popcountll(x)
+#define CTZ64(x) __builtin_ctzll(x)
+
+#else
+
+static int POPCOUNT64(uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (int)((x * 0x0101010101010101ull) >> 56);
+}
+
+static int CTZ64(uint64_t x) {
+    return POPCOUNT64((x & -x) - 1);
+}
+
+#endif
+
+#endif /* _OJ_BITOPS_H */
@@ -236,13 +236,13 @@ oj_card ojl_pop(oj_cardlist *p) {
 }
 
 // Remove and return a randomly-selected card.
-oj_card ojl_pop_random(oj_cardlist *p) {
+oj_card ojl_pop_random_r(oj_cardlist *p, ojr_state *rs) {
     int c, r;
     assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
 
     if (p->pflags & OJF_RDONLY) ER(OJE_RDONLY);
     if (0 == p->length) ER(OJE_BADINDEX);
-    r = ojr_rand(p->length);
+    r = ojr_rand_r(rs, p->length);
     c = p->cards[r];
 
     if (p->pflags & OJF_UNIQUE) CLEAR(p->mask, c);
@@ -251,6 +251,10 @@ oj_card ojl_pop_random(oj_cardlist *p) {
     return c;
 }
 
+oj_card ojl_pop_random(oj_cardlist *p) {
+    return ojl_pop_random_r(p, ojr_default_state());
+}
+
 // Return the index of the given card, if found.
 int ojl_index(oj_cardlist *p, oj_card card) {
     int i;
@@ -415,7 +419,10 @@ void _ojl_sort_cards(oj_card *cp, int n) {
     default:
         break;
     }
-    pivot = ojr_rand(n);
+    // Median of three for the pivot. This also leaves a card no lower
+    // than it at the end, so the first scan from the left stops in time.
+    pivot = n >> 1;
+    CSWP(0, pivot); CSWP(pivot, n-1); CSWP(0, pivot);
     SWAP(0, pivot);
 
     left = 0;
@@ -486,32 +493,157 @@ int ojl_fill(oj_cardlist *p, int count, oj_decktype dt) {
 }
 
 // Standard Fisher-Yates shuffle.
-int ojl_shuffle(oj_cardlist *p) {
+int ojl_shuffle_r(oj_cardlist *p, ojr_state *rs) {
     oj_card t, *cp = p->cards;
     assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
     if (p->pflags & OJF_RDONLY) ER(OJE_RDONLY);
 
     if (p->length < 2) return 0;
     for (int i = p->length-1; i > 0; --i) {
-        int j = ojr_rand(i+1);
+        int j = ojr_rand_r(rs, i+1);
         SWAP(i,j);
     }
     p->eflags = 0;
     return 0;
 }
 
+int ojl_shuffle(oj_cardlist *p) {
+    return ojl_shuffle_r(p, ojr_default_state());
+}
+
 // Fill with shuffled copy of standard deck.
+int ojl_fill_shuffled_r(oj_cardlist *p, oj_decktype dt, ojr_state *rs) {
+    oj_cardlist *dp = ojd_deck(dt);
+    oj_card *cp = p->cards, *sp = dp->cards;
+    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
+
+    if (p->pflags & OJF_RDONLY) ER(OJE_RDONLY);
+    if (p->allocation < dp->length) ER(OJE_FULL);
+
+    *cp = *sp;
+    for (int i = 1; i < dp->length; ++i) {
+        int j = ojr_rand_r(rs, i+1);
+        cp[i] = cp[j];
+        cp[j] = sp[i];
+    }
+    p->length = dp->length;
+    p->eflags = 0;
+    return p->length;
+}
+
 int ojl_fill_shuffled(oj_cardlist *p, oj_decktype dt) {
+    return ojl_fill_shuffled_r(p, dt, ojr_default_state());
+}
+
+/* Same shuffles, taking several indices from each 64-bit random draw with
+ * ojr_rand_descending_r(). Just as uniform, but different output for the
+ * same generator state, so these are separate functions.
+ */
+#define _BATCH 64
+
+int ojl_shuffle_batched_r(oj_cardlist *p, ojr_state *rs) {
+    oj_card t, *cp = p->cards;
+    uint32_t idx[_BATCH];
+    int k;
+    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
+    if (p->pflags & OJF_RDONLY) ER(OJE_RDONLY);
+
+    for (int i = p->length-1; i > 0; i -= k) {
+        k = (i < _BATCH) ? i : _BATCH;
+        ojr_rand_descending_r(rs, i+1, idx, k);
+        for (int m = 0; m < k; ++m) SWAP(i-m, (int)idx[m]);
+    }
+    p->eflags = 0;
+    return 0;
+}
+
+int ojl_shuffle_batched(oj_cardlist *p) {
+    return ojl_shuffle_batched_r(p, ojr_default_state());
+}
+
+int ojl_fill_shuffled_batched_r(oj_cardlist *p, oj_decktype dt,
+    ojr_state *rs) {
     oj_cardlist *dp = ojd_deck(dt);
     oj_card *cp = p->cards, *sp = dp->cards;
+    uint32_t idx[_BATCH];
+    int j, n = dp->length;
+    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
+    assert(n <= _BATCH);
+
+    if (p->pflags & OJF_RDONLY) ER(OJE_RDONLY);
+    if (p->allocation < n) ER(OJE_FULL);
+
+    // Bound i+1 is at idx[n-1-i].
+    ojr_rand_descending_r(rs, n, idx, n-1);
+    *cp = *sp;
+    for (int i = 1; i < n; ++i) {
+        j = idx[n-1-i];
+        cp[i] = cp[j];
+        cp[j] = sp[i];
+    }
+    p->length = n;
+    p->eflags = 0;
+    return p->length;
+}
+
+int ojl_fill_shuffled_batched(oj_cardlist *p, oj_decktype dt) {
+    return ojl_fill_shuffled_batched_r(p, dt, ojr_default_state());
+}
+
+/* Random numbers for deal number <index> of the session keyed by <seed>,
+ * from successive Philox blocks with counter (index, block number).
+ */
+typedef struct _deal_stream {
+    uint32_t ctr[4], key[2], out[4];
+    int n;
+} deal_stream;
+
+static uint32_t _deal_next(deal_stream *ds) {
+    if (0 == ds->n) {
+        ojr_philox(ds->ctr, ds->key, ds->out);
+        ++ds->ctr[2];
+        ds->n = 4;
+    }
+    return ds->out[--ds->n];
+}
+
+// Unbiased integer in [0, limit) by Lemire's multiply-and-reject.
+static int _deal_rand(deal_stream *ds, uint32_t limit) {
+    uint64_t m = (uint64_t)_deal_next(ds) * limit;
+    uint32_t t;
+
+    if ((uint32_t)m < limit) {
+        t = -limit % limit;
+        while ((uint32_t)m < t) m = (uint64_t)_deal_next(ds) * limit;
+    }
+    return (int)(m >> 32);
+}
+
+/* Fill with deal number <index> of the session keyed by <seed>: the same
+ * (seed, index) always gives the same deck, and any deck can be dealt
+ * without dealing the ones before it.
+ */
+int ojl_fill_shuffled_at(oj_cardlist *p, oj_decktype dt, uint64_t seed,
+    uint64_t index) {
+    oj_cardlist *dp = ojd_deck(dt);
+    oj_card *cp = p->cards, *sp = dp->cards;
+    deal_stream ds;
     assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
 
     if (p->pflags & OJF_RDONLY) ER(OJE_RDONLY);
     if (p->allocation < dp->length) ER(OJE_FULL);
 
+    ds.ctr[0] = (uint32_t)index;
+    ds.ctr[1] = (uint32_t)(index >> 32);
+    ds.ctr[2] = 0;
+    ds.ctr[3] = 0x4F4A4445; // "OJDE"
+    ds.key[0] = (uint32_t)seed;
+    ds.key[1] = (uint32_t)(seed >> 32);
+    ds.n = 0;
+
     *cp = *sp;
     for (int i = 1; i < dp->length; ++i) {
-        int j = ojr_rand(i+1);
+        int j = _deal_rand(&ds, i+1);
         cp[i] = cp[j];
         cp[j] = sp[i];
     }
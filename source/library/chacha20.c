@@ -0,0 +1,98 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * ChaCha20 stream cipher by Daniel J. Bernstein, used as a generator: the
+ * keystream for a 256-bit key. <http://cr.yp.to/chacha.html> The block
+ * function is the one in RFC 8439, with words 12 to 15 of the input taken
+ * together as a 128-bit block counter rather than counter and nonce.
+ * Slowest of the engines, but its output can't be predicted without the
+ * key, so this is the one to deal real-money games with, seeded from
+ * system entropy.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include "ojcardlib.h"
+
+#define _ROTL(x, k) (((x) << (k)) | ((x) >> (32 - (k))))
+#define _QR(a, b, c, d) do { \
+    a += b; d ^= a; d = _ROTL(d, 16); \
+    c += d; b ^= c; b = _ROTL(b, 12); \
+    a += b; d ^= a; d = _ROTL(d, 8); \
+    c += d; b ^= c; b = _ROTL(b, 7); \
+} while (0)
+
+static void _setup(uint32_t *in, const uint32_t *key) {
+    in[0] = 0x61707865;     // "expand 32-byte k"
+    in[1] = 0x3320646E;
+    in[2] = 0x79622D32;
+    in[3] = 0x6B206574;
+    for (int i = 0; i < 8; ++i) in[4 + i] = key[i];
+    in[12] = in[13] = in[14] = in[15] = 0;
+}
+
+// Key from 256 bits of seed, counter at zero.
+void _ojr_chacha20_key(ojr_state *s, const uint32_t *e) {
+    _setup(s->es.chacha, e);
+}
+
+// Output block for the current counter, then count it.
+static void _block(uint32_t *in, uint32_t *out) {
+    uint32_t x[16];
+    int i;
+
+    for (i = 0; i < 16; ++i) x[i] = in[i];
+    for (i = 0; i < 10; ++i) {
+        _QR(x[0], x[4], x[8], x[12]);
+        _QR(x[1], x[5], x[9], x[13]);
+        _QR(x[2], x[6], x[10], x[14]);
+        _QR(x[3], x[7], x[11], x[15]);
+        _QR(x[0], x[5], x[10], x[15]);
+        _QR(x[1], x[6], x[11], x[12]);
+        _QR(x[2], x[7], x[8], x[13]);
+        _QR(x[3], x[4], x[9], x[14]);
+    }
+    for (i = 0; i < 16; ++i) out[i] = x[i] + in[i];
+
+    for (i = 12; i < 16; ++i) if (0 != ++in[i]) break;
+}
+
+// Condense 16 more bytes <m> into 256 bits of seed <h>: the block for key
+// <h> with <m> as counter, its two halves xored together.
+void _ojr_chacha20_mix(uint32_t *h, const uint32_t *m) {
+    uint32_t in[16], out[16];
+
+    _setup(in, h);
+    for (int i = 0; i < 4; ++i) in[12 + i] = m[i];
+    _block(in, out);
+    for (int i = 0; i < 8; ++i) h[i] = out[i] ^ out[8 + i];
+}
+
+void _ojr_chacha20_reload(ojr_state *s) {
+    for (int i = 0; i < 2 * OJR_RING_WORDS; i += 16) {
+        _block(s->es.chacha, s->ring.u32 + i);
+    }
+}
+
+// Jump by whole 64-byte blocks: the distance in 64-bit words, rounded up
+// to a multiple of 8.
+void _ojr_chacha20_jump(ojr_state *s, uint64_t lo, uint64_t hi) {
+    uint32_t *in = s->es.chacha, d[4];
+    uint64_t t, c = (0 != (lo & 7));
+
+    lo = (lo >> 3) | (hi << 61);
+    hi >>= 3;
+    d[0] = (uint32_t)lo; d[1] = (uint32_t)(lo >> 32);
+    d[2] = (uint32_t)hi; d[3] = (uint32_t)(hi >> 32);
+
+    for (int i = 0; i < 4; ++i) {
+        t = (uint64_t)in[12 + i] + d[i] + c;
+        in[12 + i] = (uint32_t)t;
+        c = t >> 32;
+    }
+}
@@ -0,0 +1,20 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Internal flag bits of the combiner, multiset and dealer structures,
+ * kept clear of the public OJC_ flags. Not part of the public interface.
+ */
+
+#ifndef _OJ_COMBFLAGS_H
+#define _OJ_COMBFLAGS_H
+
+// Set while the combination in map[] has not yet been handed out, so that
+// the first call to ojc_next() doesn't advance past it.
+#define _OJC_PENDING 0x4000
+// Set once a combiner has been used with ojc_next_random().
+#define _OJC_RANDOM 0x2000
+
+#endif /* _OJ_COMBFLAGS_H */
@@ -13,22 +13,28 @@
 #include <string.h>
 #include <limits.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
 #include "ojcardlib.h"
-#include "bctable.h"
+#include "pascaltable.h"
+#include "bitops.h"
+#include "combflags.h"
 
 // Return (n choose k).
 int64_t ojc_binomial(int n, int k) {
     assert(n >= 0 && k >= 0);
 
+    if (n < 64 && k < 64) return _pascal[n][k];
     if (0 == k || n == k) return 1LL;
     if (k > n) return 0LL;
 
     if (k > (n - k)) k = n - k;
     if (1 == k) return (long long)n;
 
-    if (n <= 54 && k <= 54) {
-        return bctable[(((n - 3) * (n - 3)) >> 2) + k];
-    }
     // Last resort: actually calculate
     int64_t b = 1LL;
     for (int i = 1; i <= k; ++i) {
@@ -61,10 +67,14 @@ int ojc_new(
     cp->deck = deck;
     cp->hand = hand;
     cp->k = k;
+    cp->flags = _OJC_PENDING;
+    cp->out = cp->in = 0;
+    cp->slot = -1;
 
     cp->total = ojc_binomial(deck->length, k);
     if (0 == count) cp->remaining = cp->total;
     else cp->remaining = count;
+    cp->rank = 0LL;
 
     hand->length = k;
     for (i = 0; i < k; ++i) hand->cards[i] = deck->cards[i];
@@ -76,42 +86,170 @@ int ojc_new(
     return 0;
 }
 
+static void _colex_indices(oj_combiner *, int64_t, oj_card *);
+
+// Initialize a combiner that produces the combinations with colex ranks
+// first_rank up to but not including last_rank, so that an enumeration can
+// be split into pieces or resumed in the middle.
+int ojc_new_range(
+    oj_combiner *cp,
+    oj_cardlist *deck,
+    oj_cardlist *hand,
+    int k,
+    int64_t first_rank,
+    int64_t last_rank)
+{
+    int r = ojc_new(cp, deck, hand, k, 0LL);
+    if (r) return r;
+
+    if (first_rank < 0 || first_rank > last_rank ||
+        last_rank > cp->total) return OJE_BADINDEX;
+
+    if (first_rank < cp->total) _colex_indices(cp, first_rank, cp->map);
+    cp->rank = first_rank;
+    cp->remaining = last_rank - first_rank;
+    return 0;
+}
+
+// Bounds of piece <index> of <nchunks> nearly equal pieces of [0, total).
+// Using many more pieces than threads lets a work-stealing pool balance
+// uneven work.
+int ojc_chunk(
+    int64_t total,
+    int nchunks,
+    int index,
+    int64_t *first_rank,
+    int64_t *last_rank)
+{
+    int64_t q, r;
+    assert(0 != first_rank && 0 != last_rank);
+
+    if (total < 0 || nchunks <= 0) return OJE_BADINDEX;
+    if (index < 0 || index >= nchunks) return OJE_BADINDEX;
+
+    q = total / nchunks;
+    r = total % nchunks;
+    *first_rank = q * index + ((index < r) ? index : r);
+    *last_rank = *first_rank + q + ((index < r) ? 1 : 0);
+    return 0;
+}
+
+static int _next_revdoor(oj_combiner *);
+
+// Step the indices in <a> to the next combination in colex order.
+static inline void _colex_advance(oj_card *a, int k, int n) {
+    int i, j;
+
+    for (i = 0; i < k-1; ++i) {
+        if (a[i] < a[i+1] - 1) break;
+    }
+    assert(! ((i == k-1) && (a[i] == n-1)));
+    (void)n;
+
+    ++a[i];
+    for (j = 0; j < i; ++j) a[j] = j;
+}
+
 // Generate next combination in colex order
 int ojc_next(oj_combiner *cp) {
-    int i, j, k = cp->k, n = cp->deck->length;
+    int k = cp->k, n = cp->deck->length;
     oj_card *a = cp->map;
     assert(0 != cp && 0x10ACE0FF == cp->_johnnymoss);
 
     if (0 == cp->remaining) return 0;
+    if (cp->flags & OJC_REVDOOR) return _next_revdoor(cp);
 
-    if (cp->remaining != cp->total) {
-        for (i = 0; i < k-1; ++i) {
-            if (a[i] < a[i+1] - 1) break;
-        }
-        assert(! ((i == k-1) && (a[i] == n-1)));
-
-        ++a[i];
-        for (j = 0; j < i; ++j) a[j] = j;
+    if (cp->flags & _OJC_PENDING) {
+        cp->flags &= ~_OJC_PENDING;
+    } else {
+        _colex_advance(a, k, n);
     }
     for (int c = 0; c < k; ++c) {
         cp->hand->cards[c] = cp->deck->cards[a[c]];
     }
     --cp->remaining;
+    ++cp->rank;
     cp->hand->eflags = 0;
     return 1;
 }
 
-int ojc_next_random(oj_combiner *cp) {
+/* Fill <count> combinations into <out>, each hand taking k consecutive
+ * cards. Most steps in colex order change only the lowest card, so we
+ * write whole runs of those at once with the other k-1 cards held in
+ * locals. <k> is a constant at each call site below, so the compiler can
+ * unroll the copies for the common hand sizes.
+ */
+static inline int _block(oj_combiner *cp, oj_card *out, int count, const int k) {
+    oj_card *a = cp->map, *dc = cp->deck->cards, up[56];
+    int j, run, limit, done = 0, n = cp->deck->length;
+
+    while (1) {
+        limit = (k > 1) ? a[1] : n;
+        run = limit - a[0];
+        if (run > count - done) run = count - done;
+
+        for (int i = 1; i < k; ++i) up[i] = dc[a[i]];
+        for (j = 0; j < run; ++j, out += k) {
+            out[0] = dc[a[0] + j];
+            for (int i = 1; i < k; ++i) out[i] = up[i];
+        }
+        done += run;
+        a[0] += run - 1;
+        if (done == count) break;
+        _colex_advance(a, k, n);
+    }
+    return done;
+}
+
+// Generate up to <max> combinations into a flat buffer of k-card hands,
+// suitable for the batch evaluators. Returns the number generated. The
+// combiner's hand is left holding the last one.
+int ojc_next_block(oj_combiner *cp, oj_card *out, int max) {
+    int done, k = cp->k;
+    assert(0 != cp && 0x10ACE0FF == cp->_johnnymoss);
+    assert(0 != out && max >= 0);
+
+    if (max > cp->remaining) max = (int)cp->remaining;
+    if (0 == max) return 0;
+
+    if ((cp->flags & OJC_REVDOOR) || 0 == k) {
+        for (done = 0; done < max && ojc_next(cp); ++done, out += k) {
+            memmove(out, cp->hand->cards, k * sizeof(oj_card));
+        }
+        return done;
+    }
+    if (cp->flags & _OJC_PENDING) {
+        cp->flags &= ~_OJC_PENDING;
+    } else {
+        _colex_advance(cp->map, k, cp->deck->length);
+    }
+    switch (k) {
+    case 2: done = _block(cp, out, max, 2); break;
+    case 3: done = _block(cp, out, max, 3); break;
+    case 5: done = _block(cp, out, max, 5); break;
+    case 7: done = _block(cp, out, max, 7); break;
+    default: done = _block(cp, out, max, k); break;
+    }
+    memmove(cp->hand->cards, out + (done - 1) * k, k * sizeof(oj_card));
+    cp->hand->length = k;
+    cp->remaining -= done;
+    cp->rank += done;
+    cp->hand->eflags = 0;
+    return done;
+}
+
+int ojc_next_random_r(oj_combiner *cp, ojr_state *rs) {
     int k = cp->k, n = cp->deck->length;
     oj_card *mp = cp->map;
     assert(0 != cp && 0x10ACE0FF == cp->_johnnymoss);
 
     if (0 == cp->remaining) return 0;
+    cp->flags |= _OJC_RANDOM;
 
     // Bob Floyd's algorithm
     int_fast64_t set = 0ll, m;
     for (int j = n - k; j < n; ++j) {
-        int r = ojr_rand(j+1);
+        int r = ojr_rand_r(rs, j+1);
         m = 1ll << r;
 
         if (set & m) {
@@ -130,41 +268,532 @@ int ojc_next_random(oj_combiner *cp) {
     return 1;
 }
 
-extern void _ojl_sort_cards(oj_card *cp, int n);
+int ojc_next_random(oj_combiner *cp) {
+    return ojc_next_random_r(cp, ojr_default_state());
+}
+
+/* Colex rank from the deck indices of a hand in any order. A card's slot
+ * in the sorted hand is just the number of hand cards below it in the
+ * deck, so a popcount of the hand mask replaces the sort. Returns -1 if
+ * the hand repeats a card.
+ */
+static inline int64_t _colex_rank(const oj_card *cards, const oj_card *invert,
+    int k) {
+    uint64_t m = 0ull;
+    int64_t r = 0LL;
+    int i, x;
+
+    for (i = 0; i < k; ++i) m |= 1ull << invert[cards[i]];
+    if (POPCOUNT64(m) != k) return -1LL;
+
+    for (i = 0; i < k; ++i) {
+        x = invert[cards[i]];
+        r += _pascal[x][POPCOUNT64(m & ((1ull << x) - 1)) + 1];
+    }
+    return r;
+}
 
 // Return colex rank of given hand
 int64_t ojc_colex_rank(oj_combiner *cp, oj_cardlist *hand) {
-    oj_card buf[56];
-    int64_t r = 0LL;
     assert(0 != hand && 0 != cp);
     assert(hand->length < 64);
 
     if (hand->length != cp->k) return -1LL;
+    return _colex_rank(hand->cards, cp->invert, cp->k);
+}
 
-    for (int i = 0; i < cp->k; ++i) buf[i] = cp->invert[hand->cards[i]];
-    _ojl_sort_cards(buf, cp->k);
-    for (int i = 0; i < cp->k; ++i) r += ojc_binomial(buf[i], i + 1);
-    return r;
+// Colex ranks of <count> k-card hands packed end to end in <hands>, as
+// produced by ojc_next_block(). Bad hands get -1.
+void ojc_colex_rank_many(oj_combiner *cp, const oj_card *hands, int count,
+    int64_t *out) {
+    int k = cp->k;
+    assert(0 != cp && 0 != hands && 0 != out);
+
+    for (int i = 0; i < count; ++i, hands += k) {
+        out[i] = _colex_rank(hands, cp->invert, k);
+    }
+}
+
+/* Put the deck indices of the combination at the given rank into buf. The
+ * largest n with C(n, i) <= rank is found by binary search down column i
+ * of the table; it can only be below the one found for i + 1.
+ */
+static void _colex_indices(oj_combiner *cp, int64_t rank, oj_card *buf) {
+    int lo, hi, mid, n = cp->deck->length;
+
+    for (int i = cp->k; i >= 1; --i) {
+        lo = i - 1;
+        hi = n - 1;
+        while (lo < hi) {
+            mid = (lo + hi + 1) >> 1;
+            if (_pascal[mid][i] <= rank) lo = mid;
+            else hi = mid - 1;
+        }
+        buf[i-1] = n = lo;
+        rank -= _pascal[lo][i];
+    }
 }
 
 // Return hand at given rank
 int ojc_colex_hand_at(oj_combiner *cp, int64_t rank, oj_cardlist *hand) {
-    int i, n = cp->deck->length;
+    int i;
     oj_card buf[64];
-    int64_t b;
     assert(0 != hand && 0 != cp);
 
     if (hand->pflags & OJF_RDONLY) return OJE_RDONLY;
     if (hand->allocation < cp->k) return OJE_FULL;
-    if (rank >= cp->total) return OJE_BADINDEX;
+    if (rank < 0 || rank >= cp->total) return OJE_BADINDEX;
 
-    for (i = cp->k; i >= 1; --i) {
-        while ((b = ojc_binomial(n, i)) > rank) --n;
-        buf[i-1] = n;
-        rank -= b;
+    _colex_indices(cp, rank, buf);
+    hand->length = cp->k;
+    for (i = 0; i < cp->k; ++i) hand->cards[i] = cp->deck->cards[buf[i]];
+    hand->eflags = 0;
+    return 0;
+}
+
+// Hands at each of <count> colex ranks, packed end to end into <out>.
+int ojc_colex_hand_at_many(oj_combiner *cp, const int64_t *ranks, int count,
+    oj_card *out) {
+    int i, j, k = cp->k;
+    oj_card buf[64];
+    assert(0 != cp && 0 != ranks && 0 != out);
+
+    for (i = 0; i < count; ++i, out += k) {
+        if (ranks[i] < 0 || ranks[i] >= cp->total) return OJE_BADINDEX;
+
+        _colex_indices(cp, ranks[i], buf);
+        for (j = 0; j < k; ++j) out[j] = cp->deck->cards[buf[j]];
     }
+    return 0;
+}
+
+// Colex rank of a 7-card hand from the standard 52-card deck: the same
+// value ojc_colex_rank() gives for a combiner over a deck in standard
+// order, but without the combiner. Walking the bits of the hand mask
+// visits the cards in ascending order.
+int64_t ojc_colex_rank7(oj_card *h) {
+    uint64_t m;
+    int64_t r = 0LL;
+    assert(0 != h);
+
+    m = (1ull << h[0]) | (1ull << h[1]) | (1ull << h[2]) | (1ull << h[3]) |
+        (1ull << h[4]) | (1ull << h[5]) | (1ull << h[6]);
+    assert(7 == POPCOUNT64(m) && 0 == (m & 1ull));
+
+    for (int k = 1; k <= 7; ++k) {
+        r += _pascal[CTZ64(m) - 1][k];
+        m &= m - 1;
+    }
+    return r;
+}
+
+/* Revolving door order (Knuth 7.2.1.3, Kreher & Stinson 2.3.3). Each
+ * combination differs from the previous one by exactly one card out and
+ * one card in. map[] holds the current deck indices in ascending order
+ * with the sentinel map[k] = n; the hand itself is changed in place, one
+ * slot per step, and out, in, and slot report the change.
+ */
+int ojc_new_revdoor(
+    oj_combiner *cp,
+    oj_cardlist *deck,
+    oj_cardlist *hand,
+    int k,
+    int64_t count)
+{
+    int r = ojc_new(cp, deck, hand, k, count);
+    if (r) return r;
+
+    cp->flags |= OJC_REVDOOR;
+    cp->map[k] = deck->length;
+    for (int i = 0; i < k; ++i) cp->position[i] = i;
+    return 0;
+}
+
+static int _next_revdoor(oj_combiner *cp) {
+    int j, lo, hi, k = cp->k;
+    oj_card *a = cp->map;
+    uint64_t om = 0ull, nm = 0ull;
+
+    if (cp->flags & _OJC_PENDING) {
+        cp->flags &= ~_OJC_PENDING;
+        for (int i = 0; i < k; ++i) {
+            cp->hand->cards[i] = cp->deck->cards[a[i]];
+            cp->position[a[i]] = i;
+        }
+        cp->hand->length = k;
+        cp->out = cp->in = 0;
+        cp->slot = -1;
+        --cp->remaining;
+        ++cp->rank;
+        cp->hand->eflags = 0;
+        return 1;
+    }
+    for (j = 0; j < k && a[j] == j; ++j) ;
+
+    // Only entries j-2 through j+1 can change.
+    lo = (j < 2) ? 0 : j - 2;
+    hi = (j + 1 < k) ? j + 1 : k - 1;
+    for (int i = lo; i <= hi; ++i) om |= 1ull << a[i];
+
+    if ((k - j - 1) & 1) {
+        if (0 == j) {
+            --a[0];
+        } else {
+            a[j - 1] = j;
+            if (j > 1) a[j - 2] = j - 1;
+        }
+    } else if (a[j + 1] != a[j] + 1) {
+        if (j > 0) a[j - 1] = a[j];
+        ++a[j];
+    } else {
+        a[j + 1] = a[j];
+        a[j] = j;
+    }
+    assert(a[k] == cp->deck->length);
+    for (int i = lo; i <= hi; ++i) nm |= 1ull << a[i];
+
+    j = CTZ64(om & ~nm);
+    cp->out = cp->deck->cards[j];
+    cp->slot = cp->position[j];
+    j = CTZ64(nm & ~om);
+    cp->in = cp->deck->cards[j];
+    cp->position[j] = cp->slot;
+    cp->hand->cards[cp->slot] = cp->in;
+
+    --cp->remaining;
+    ++cp->rank;
+    cp->hand->eflags = 0;
+    return 1;
+}
+
+extern void _ojl_sort_cards(oj_card *cp, int n);
+
+// Return revolving door rank of given hand
+int64_t ojc_revdoor_rank(oj_combiner *cp, oj_cardlist *hand) {
+    oj_card buf[56];
+    int64_t r = 0LL;
+    assert(0 != hand && 0 != cp);
+
+    if (hand->length != cp->k) return -1LL;
+
+    for (int i = 0; i < cp->k; ++i) buf[i] = cp->invert[hand->cards[i]];
+    _ojl_sort_cards(buf, cp->k);
+    for (int i = 0; i < cp->k; ++i) {
+        int64_t t = ojc_binomial(buf[i] + 1, i + 1) - 1;
+        r += ((cp->k - i - 1) & 1) ? -t : t;
+    }
+    return r;
+}
+
+// Put the deck indices of the combination at the given revolving door
+// rank into buf.
+static void _revdoor_indices(oj_combiner *cp, int64_t rank, oj_card *buf) {
+    int x = cp->deck->length;
+
+    for (int i = cp->k; i >= 1; --i) {
+        while (ojc_binomial(x, i) > rank) --x;
+        buf[i - 1] = x;
+        rank = ojc_binomial(x + 1, i) - rank - 1;
+    }
+}
+
+// Return hand at given revolving door rank
+int ojc_revdoor_hand_at(oj_combiner *cp, int64_t rank, oj_cardlist *hand) {
+    int i;
+    oj_card buf[56];
+    assert(0 != hand && 0 != cp);
+
+    if (hand->pflags & OJF_RDONLY) return OJE_RDONLY;
+    if (hand->allocation < cp->k) return OJE_FULL;
+    if (rank < 0 || rank >= cp->total) return OJE_BADINDEX;
+
+    _revdoor_indices(cp, rank, buf);
     hand->length = cp->k;
     for (i = 0; i < cp->k; ++i) hand->cards[i] = cp->deck->cards[buf[i]];
     hand->eflags = 0;
     return 0;
 }
+
+/* Move a colex or revolving door combiner so that the next call to
+ * ojc_next() produces the combination at <rank>. The end of the run stays
+ * where it was, so <rank> can't be past it.
+ */
+int ojc_seek(oj_combiner *cp, int64_t rank) {
+    int64_t end = cp->rank + cp->remaining;
+    assert(0 != cp && 0x10ACE0FF == cp->_johnnymoss);
+
+    if (cp->flags & _OJC_RANDOM) return OJE_BADINDEX;
+    if (rank < 0 || rank > end || rank > cp->total) return OJE_BADINDEX;
+
+    if (rank < cp->total) {
+        if (cp->flags & OJC_REVDOOR) _revdoor_indices(cp, rank, cp->map);
+        else _colex_indices(cp, rank, cp->map);
+    }
+    cp->flags |= _OJC_PENDING;
+    cp->rank = rank;
+    cp->remaining = end - rank;
+    return 0;
+}
+
+// Rank of the combination the next call to ojc_next() will produce.
+int64_t ojc_tell(oj_combiner *cp) {
+    assert(0 != cp && 0x10ACE0FF == cp->_johnnymoss);
+    return cp->rank;
+}
+
+/* Checkpoints. A combiner's place is just its mode, rank, and count
+ * remaining, plus for random combiners the state of the generator. These
+ * are written in OJC_CHECKPOINT_SIZE bytes, little-endian, with a hash of
+ * the deck so that we don't resume against a different one:
+ *
+ *  0  "OJCK"            16  total (8)
+ *  4  version (1)       24  remaining (8)
+ *  5  mode (1)          32  rank (8)
+ *  6  k (1)             40  generator state (OJR_STATE_SIZE, random
+ *                           mode only, as ojr_get_state_r() writes it)
+ *  7  reserved (1)
+ *  8  deck length (2)
+ * 10  reserved (2)
+ * 12  deck hash (4)
+ */
+#define _OJC_CKVERSION 2
+#define _OJC_CKMODE_COLEX 0
+#define _OJC_CKMODE_REVDOOR 1
+#define _OJC_CKMODE_RANDOM 2
+
+static void _put(unsigned char *p, uint64_t v, int n) {
+    for (int i = 0; i < n; ++i, v >>= 8) p[i] = (unsigned char)v;
+}
+
+static uint64_t _get(const unsigned char *p, int n) {
+    uint64_t v = 0;
+    for (int i = n - 1; i >= 0; --i) v = (v << 8) | p[i];
+    return v;
+}
+
+// FNV-1a of the deck's cards.
+static uint32_t _deck_hash(oj_cardlist *deck) {
+    uint32_t h = 2166136261u;
+
+    for (int i = 0; i < deck->length; ++i) {
+        h = (h ^ (unsigned char)deck->cards[i]) * 16777619u;
+    }
+    return h;
+}
+
+// Write a checkpoint of the combiner, which draws from generator <rs> if
+// it is a random one, into buf. Returns the number of bytes written.
+int ojc_checkpoint_r(oj_combiner *cp, ojr_state *rs, unsigned char *buf,
+    int size) {
+    int mode = _OJC_CKMODE_COLEX;
+    assert(0 != cp && 0x10ACE0FF == cp->_johnnymoss && 0 != buf);
+
+    if (size < OJC_CHECKPOINT_SIZE) return OJE_FULL;
+    if (cp->flags & OJC_REVDOOR) mode = _OJC_CKMODE_REVDOOR;
+    if (cp->flags & _OJC_RANDOM) mode = _OJC_CKMODE_RANDOM;
+
+    memset(buf, 0, OJC_CHECKPOINT_SIZE);
+    memmove(buf, "OJCK", 4);
+    buf[4] = _OJC_CKVERSION;
+    buf[5] = mode;
+    buf[6] = cp->k;
+    _put(buf + 8, cp->deck->length, 2);
+    _put(buf + 12, _deck_hash(cp->deck), 4);
+    _put(buf + 16, cp->total, 8);
+    _put(buf + 24, cp->remaining, 8);
+    _put(buf + 32, cp->rank, 8);
+    if (_OJC_CKMODE_RANDOM == mode &&
+        ojr_get_state_r(rs, buf + 40, OJR_STATE_SIZE) < 0) return OJE_BADINDEX;
+    return OJC_CHECKPOINT_SIZE;
+}
+
+int ojc_checkpoint(oj_combiner *cp, unsigned char *buf, int size) {
+    return ojc_checkpoint_r(cp, ojr_default_state(), buf, size);
+}
+
+/* Initialize a combiner over the given deck and hand, picking up where
+ * the checkpointed one left off. For a random combiner this also puts
+ * generator <rs> back where it was, so the rest of the run repeats.
+ * A revolving door combiner gives the same combinations and swaps, but its
+ * hand starts over in deck order, so slot numbers may differ. Returns 0
+ * or negative error code: OJE_BADINDEX if the checkpoint is damaged or
+ * doesn't match the deck, OJE_FULL if the hand is too short for it.
+ */
+int ojc_restore_r(
+    oj_combiner *cp,
+    oj_cardlist *deck,
+    oj_cardlist *hand,
+    ojr_state *rs,
+    const unsigned char *buf,
+    int size)
+{
+    int r, mode, k;
+    int64_t remaining, rank;
+    assert(0 != cp && 0 != deck && 0 != hand && 0 != buf);
+
+    if (size < OJC_CHECKPOINT_SIZE || 0 != memcmp(buf, "OJCK", 4) ||
+        _OJC_CKVERSION != buf[4]) return OJE_BADINDEX;
+    mode = buf[5];
+    k = buf[6];
+    if ((int)_get(buf + 8, 2) != deck->length ||
+        (uint32_t)_get(buf + 12, 4) != _deck_hash(deck) ||
+        k > deck->length || mode > _OJC_CKMODE_RANDOM) return OJE_BADINDEX;
+    if (hand->pflags & OJF_RDONLY) return OJE_RDONLY;
+    if (k > hand->allocation) return OJE_FULL;
+
+    if (_OJC_CKMODE_REVDOOR == mode) r = ojc_new_revdoor(cp, deck, hand, k, 0LL);
+    else r = ojc_new(cp, deck, hand, k, 0LL);
+    if (r) return r;
+    if ((int64_t)_get(buf + 16, 8) != cp->total) return OJE_BADINDEX;
+
+    remaining = (int64_t)_get(buf + 24, 8);
+    rank = (int64_t)_get(buf + 32, 8);
+    if (_OJC_CKMODE_RANDOM == mode) {
+        r = ojr_set_state_r(rs, buf + 40, OJR_STATE_SIZE);
+        if (r < 0) return r;
+        cp->flags = _OJC_RANDOM;
+        cp->remaining = remaining;
+        cp->rank = rank;
+        return 0;
+    }
+    cp->rank = rank;
+    cp->remaining = remaining;
+    return ojc_seek(cp, rank);
+}
+
+int ojc_restore(
+    oj_combiner *cp,
+    oj_cardlist *deck,
+    oj_cardlist *hand,
+    const unsigned char *buf,
+    int size)
+{
+    return ojc_restore_r(cp, deck, hand, ojr_default_state(), buf, size);
+}
+
+#ifdef OJ_HAVE_INT128
+
+/* 128-bit binomials, for ranking hands dealt from shoes too big for the
+ * 64-bit functions above (a 6-deck shoe is 312 cards, and C(312, 20) is
+ * already about 10^31). Values that don't fit are -1, as with
+ * ojc_binomial(). The table covers every shoe up to eight decks with
+ * hands up to 32 cards, and is built on first use, once only even if
+ * several threads get there together.
+ */
+#define _BIG_N 512
+#define _BIG_K 32
+
+static oj_int128 _pascal128[_BIG_N][_BIG_K + 1];
+
+static void _build_pascal128(void) {
+    oj_int128 a, b;
+
+    for (int n = 0; n < _BIG_N; ++n) {
+        _pascal128[n][0] = 1;
+        for (int k = 1; k <= _BIG_K; ++k) {
+            if (0 == n) {
+                _pascal128[n][k] = 0;
+                continue;
+            }
+            a = _pascal128[n-1][k-1];
+            b = _pascal128[n-1][k];
+            if (a < 0 || b < 0 || a > OJ_INT128_MAX - b) _pascal128[n][k] = -1;
+            else _pascal128[n][k] = a + b;
+        }
+    }
+}
+
+#ifdef _WIN32
+static INIT_ONCE _pascal128_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK _build_once(PINIT_ONCE o, PVOID p, PVOID *c) {
+    (void)o; (void)p; (void)c;
+    _build_pascal128();
+    return TRUE;
+}
+#define _PASCAL128_READY() \
+    InitOnceExecuteOnce(&_pascal128_once, _build_once, 0, 0)
+#else
+static pthread_once_t _pascal128_once = PTHREAD_ONCE_INIT;
+#define _PASCAL128_READY() pthread_once(&_pascal128_once, _build_pascal128)
+#endif
+
+static int _gcd(int a, int b) {
+    while (b) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Return (n choose k), or -1 if it won't fit.
+oj_int128 ojc_binomial128(int n, int k) {
+    oj_int128 b = 1;
+    assert(n >= 0 && k >= 0);
+
+    if (n < 64 && k < 64) return _pascal[n][k];
+    if (k > n) return 0;
+    if (k > (n - k)) k = n - k;
+
+    if (n < _BIG_N && k <= _BIG_K) {
+        _PASCAL128_READY();
+        return _pascal128[n][k];
+    }
+    /* b = C(n-k+i, i) at each step. Take out of b whatever it shares with
+     * i first; what is left of i then divides n-k+i, and the product is
+     * the next value itself, so it only overflows if that doesn't fit.
+     */
+    for (int i = 1; i <= k; ++i) {
+        int g = _gcd((int)(b % i), i), d = i / g, m = (n - k + i) / d;
+
+        b /= g;
+        if (b > OJ_INT128_MAX / m) return -1;
+        b *= m;
+    }
+    return b;
+}
+
+// Colex rank of the combination with the given deck positions, which
+// must be in ascending order. Returns -1 if they aren't, or on overflow.
+oj_int128 ojc_colex_rank128(const int *pos, int k) {
+    oj_int128 b, r = 0;
+    assert(0 != pos && k >= 0);
+
+    for (int i = 0; i < k; ++i) {
+        if (pos[i] < 0 || (i > 0 && pos[i] <= pos[i-1])) return -1;
+        b = ojc_binomial128(pos[i], i + 1);
+        if (b < 0 || r > OJ_INT128_MAX - b) return -1;
+        r += b;
+    }
+    return r;
+}
+
+// Put the ascending deck positions of the k-of-n combination at the given
+// colex rank into pos. Returns OJE_FULL if C(n, k) won't fit.
+int ojc_colex_at128(oj_int128 rank, int n, int k, int *pos) {
+    int lo, hi, mid;
+    oj_int128 b;
+    assert(0 != pos && n >= k && k >= 0);
+
+    if ((b = ojc_binomial128(n, k)) < 0) return OJE_FULL;
+    if (rank < 0 || rank >= b) return OJE_BADINDEX;
+
+    // Binary search for the largest x with C(x, i) <= rank. Every C(x, i)
+    // probed has i <= k and x - i <= n - k, so it is no bigger than
+    // C(n, k) and can't overflow.
+    for (int i = k; i >= 1; --i) {
+        lo = i - 1;
+        hi = n - 1;
+        while (lo < hi) {
+            mid = (lo + hi + 1) >> 1;
+            if (ojc_binomial128(mid, i) <= rank) lo = mid;
+            else hi = mid - 1;
+        }
+        pos[i-1] = n = lo;
+        rank -= ojc_binomial128(lo, i);
+    }
+    return 0;
+}
+
+#endif /* OJ_HAVE_INT128 */
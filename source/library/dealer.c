@@ -0,0 +1,185 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Enumerating deals of disjoint hands: every way to deal hands of sizes
+ * k1, k2, ... from a deck, such as two hold'em hands and a board, or four
+ * bridge hands. Each group is an ordinary combiner over the cards the
+ * earlier groups left behind, and the last group varies fastest, like
+ * nested loops. A deal's rank is mixed-radix in the groups' colex ranks,
+ * which is the multinomial count of deals before it. That needs more than
+ * 64 bits for bridge, so this is all 128-bit.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "ojcardlib.h"
+#include "bitops.h"
+#include "combflags.h"
+
+#ifdef OJ_HAVE_INT128
+
+// Copy into <out> the cards of <from> that are not in <hand>. <out> may
+// be <from>.
+static void _residue(oj_cardlist *from, oj_cardlist *hand, oj_cardlist *out) {
+    uint64_t m = 0ull;
+    int i, j, n = from->length;
+
+    for (i = 0; i < hand->length; ++i) m |= 1ull << hand->cards[i];
+    for (i = j = 0; i < n; ++i) {
+        if (! (m & (1ull << from->cards[i]))) out->cards[j++] = from->cards[i];
+    }
+    out->length = j;
+    out->eflags = 0;
+}
+
+// Restart groups <g> and above at their first combinations.
+static void _restart(oj_dealer *dp, int g) {
+    for (; g < dp->ngroups; ++g) {
+        if (g > 0) _residue(&dp->rest[g-1], dp->hands[g-1], &dp->rest[g]);
+        ojc_new(&dp->comb[g], &dp->rest[g], dp->hands[g], dp->sizes[g], 0LL);
+        ojc_next(&dp->comb[g]);
+    }
+}
+
+// Initialize a dealer of <ngroups> hands with the given sizes. Returns 0
+// or negative error code; OJE_FULL if the number of deals doesn't fit in
+// 128 bits.
+int ojc_dealer_new(
+    oj_dealer *dp,
+    oj_cardlist *deck,
+    oj_cardlist **hands,
+    const int *sizes,
+    int ngroups)
+{
+    int g, n;
+    oj_int128 total = 1, r;
+    assert(0 != dp && 0 != deck && 0 != hands && 0 != sizes);
+    assert(deck->length <= 54);
+
+    if (ngroups < 1 || ngroups > OJC_DEALER_MAXGROUPS) return OJE_BADINDEX;
+    for (n = deck->length, g = 0; g < ngroups; ++g) {
+        if (sizes[g] < 0 || sizes[g] > n) return OJE_BADINDEX;
+        if (hands[g]->allocation < sizes[g]) return OJE_FULL;
+        if (hands[g]->pflags & OJF_RDONLY) return OJE_RDONLY;
+        if (hands[g]->pflags & OJF_UNIQUE) return OJE_DUPLICATE;
+
+        r = ojc_binomial(n, sizes[g]);
+        if (total > OJ_INT128_MAX / r) return OJE_FULL;
+        total *= r;
+        n -= sizes[g];
+    }
+    dp->_johnnymoss = 0x10ACE0FF;
+    dp->deck = deck;
+    dp->ngroups = ngroups;
+    dp->flags = _OJC_PENDING;
+
+    dp->total = total;
+    for (n = deck->length, g = 0; g < ngroups; ++g) {
+        dp->hands[g] = hands[g];
+        dp->sizes[g] = sizes[g];
+        dp->radix[g] = ojc_binomial(n, sizes[g]);
+        n -= sizes[g];
+
+        ojl_new(&dp->rest[g], dp->restbuf[g], 56);
+    }
+    memmove(dp->rest[0].cards, deck->cards, deck->length * sizeof(oj_card));
+    dp->rest[0].length = deck->length;
+    dp->remaining = dp->total;
+    dp->rank = 0;
+
+    _restart(dp, 0);
+    return 0;
+}
+
+// Deal the next set of hands; 0 when done.
+int ojc_dealer_next(oj_dealer *dp) {
+    int g;
+    assert(0 != dp && 0x10ACE0FF == dp->_johnnymoss);
+
+    if (0 == dp->remaining) return 0;
+
+    if (dp->flags & _OJC_PENDING) {
+        dp->flags &= ~_OJC_PENDING;
+    } else {
+        for (g = dp->ngroups - 1; g >= 0; --g) {
+            if (ojc_next(&dp->comb[g])) break;
+        }
+        assert(g >= 0);
+        _restart(dp, g + 1);
+    }
+    --dp->remaining;
+    ++dp->rank;
+    return 1;
+}
+
+// Return the rank of the deal in <hands>, or -1 if it isn't one.
+oj_int128 ojc_dealer_rank(oj_dealer *dp, oj_cardlist **hands) {
+    int g, i, j, pos[56], inv[55];
+    uint64_t m, used = 0ull;
+    oj_int128 r, rank = 0;
+    oj_card *dc = dp->deck->cards;
+    assert(0 != dp && 0 != hands);
+
+    for (g = 0; g < dp->ngroups; ++g) {
+        if (hands[g]->length != dp->sizes[g]) return -1;
+
+        // Positions of the group's cards among those still in the deck.
+        for (i = 0; i < 55; ++i) inv[i] = -1;
+        for (i = j = 0; i < dp->deck->length; ++i) {
+            if (! (used & (1ull << dc[i]))) inv[dc[i]] = j++;
+        }
+        for (m = 0ull, i = 0; i < hands[g]->length; ++i) {
+            if (inv[hands[g]->cards[i]] < 0) return -1;
+            m |= 1ull << inv[hands[g]->cards[i]];
+            used |= 1ull << hands[g]->cards[i];
+        }
+        if (POPCOUNT64(m) != dp->sizes[g]) return -1;
+        for (i = 0; m; ++i, m &= m - 1) pos[i] = CTZ64(m);
+
+        r = ojc_colex_rank128(pos, dp->sizes[g]);
+        rank = rank * dp->radix[g] + r;
+    }
+    return rank;
+}
+
+// Put the deal at the given rank into <hands>.
+int ojc_dealer_deal_at(oj_dealer *dp, oj_int128 rank, oj_cardlist **hands) {
+    int g, i, pos[56];
+    int64_t sub[OJC_DEALER_MAXGROUPS];
+    oj_card buf[56];
+    oj_cardlist rest;
+    assert(0 != dp && 0 != hands);
+
+    if (rank < 0 || rank >= dp->total) return OJE_BADINDEX;
+    for (g = dp->ngroups - 1; g >= 0; --g) {
+        sub[g] = (int64_t)(rank % dp->radix[g]);
+        rank /= dp->radix[g];
+    }
+    ojl_new(&rest, buf, 56);
+    memmove(buf, dp->deck->cards, dp->deck->length * sizeof(oj_card));
+    rest.length = dp->deck->length;
+
+    for (g = 0; g < dp->ngroups; ++g) {
+        if (hands[g]->pflags & OJF_RDONLY) return OJE_RDONLY;
+        if (hands[g]->pflags & OJF_UNIQUE) return OJE_DUPLICATE;
+        if (hands[g]->allocation < dp->sizes[g]) return OJE_FULL;
+
+        ojc_colex_at128(sub[g], rest.length, dp->sizes[g], pos);
+        for (i = 0; i < dp->sizes[g]; ++i) {
+            hands[g]->cards[i] = rest.cards[pos[i]];
+        }
+        hands[g]->length = dp->sizes[g];
+        hands[g]->eflags = 0;
+        _residue(&rest, hands[g], &rest);
+    }
+    return 0;
+}
+
+#endif /* OJ_HAVE_INT128 */
@@ -32,26 +32,31 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
 
 #else /* This is the Linux Way */
 
-void _init(void) {
+__attribute__((constructor))
+static void _oj_load(void) {
     int r;
 
     r = oj_init_library(0);
     if (r) exit(EXIT_FAILURE);
-    return;
-}
-
-void _fini(void) {
-    return;
 }
 
 #endif
 
+extern void _ojr_lazy_default(void);
+
+/* Set up the library. A nonzero <seed> seeds the default generator now;
+ * with 0 it will be seeded from system entropy when first used, so merely
+ * loading the library costs no system calls.
+ */
 int oj_init_library(int seed) {
     int r;
 
-    r = ojr_seed(seed);
-    if (r) return r;
-
+    if (seed) {
+        r = ojr_seed(seed);
+        if (r) return r;
+    } else {
+        _ojr_lazy_default();
+    }
     _oj_johnnymoss = 0x10ACE0FF;
     return 0;
 }
@@ -0,0 +1,231 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Combinations of <k> cards from a deck with repeated cards, such as a
+ * multi-deck shoe. The ordinary combiner treats every position in the deck
+ * as distinct, so six copies of the same card would give six "different"
+ * hands. Here the state is instead a vector counts[] of how many copies of
+ * each distinct card value are in the hand, and each such multiset is
+ * produced once along with its weight, the number of ways to deal it.
+ *
+ * Multisets come in lexicographic order of counts[] from largest to
+ * smallest, so the first hand is the lowest cards in the deck, as many
+ * copies of each as the deck holds. ways[i][j] is the number of j-card
+ * multisets that can be made from types i and above, which is all we need
+ * to count, rank and unrank.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "ojcardlib.h"
+#include "combflags.h"
+
+// Number of ways to deal the multiset in counts[].
+static int64_t _weight(oj_multiset *mp) {
+    int64_t w = 1LL;
+
+    for (int i = 0; i < mp->ntypes; ++i) {
+        if (mp->counts[i]) w *= ojc_binomial(mp->mult[i], mp->counts[i]);
+    }
+    return w;
+}
+
+/* Whether every <k>-card multiset's weight fits in 64 bits. most[j] is
+ * the largest weight of a j-card multiset from the types seen so far, 0
+ * if there is none, or -1 if it doesn't fit.
+ */
+static int _weights_fit(oj_multiset *mp, int k) {
+    int64_t most[OJC_MULTISET_MAXK + 1], w, b;
+
+    for (int j = 0; j <= k; ++j) most[j] = (0 == j);
+    for (int i = 0; i < mp->ntypes; ++i) {
+        for (int j = k; j > 0; --j) {
+            for (int v = 1; v <= j && v <= mp->mult[i]; ++v) {
+                if (0 == most[j - v] || -1 == most[j]) continue;
+                b = ojc_binomial(mp->mult[i], v);
+                if (-1 == most[j - v] || b < 0 ||
+                    most[j - v] > INT64_MAX / b) {
+                    most[j] = -1;
+                    continue;
+                }
+                w = most[j - v] * b;
+                if (w > most[j]) most[j] = w;
+            }
+        }
+    }
+    return -1 != most[k];
+}
+
+// Put the counts[] vector into the hand, cards in ascending order.
+static void _emit(oj_multiset *mp) {
+    oj_card *hp = mp->hand->cards;
+
+    for (int i = 0; i < mp->ntypes; ++i) {
+        for (int j = 0; j < mp->counts[i]; ++j) *hp++ = mp->types[i];
+    }
+    mp->hand->length = mp->k;
+    mp->hand->eflags = 0;
+    mp->weight = _weight(mp);
+}
+
+// Fill types <i> and above with <r> cards, lowest first, each as full as
+// the deck allows.
+static void _fill(oj_multiset *mp, int i, int r) {
+    for (; i < mp->ntypes; ++i) {
+        mp->counts[i] = (r < mp->mult[i]) ? r : mp->mult[i];
+        r -= mp->counts[i];
+    }
+    assert(0 == r);
+}
+
+// Initialize a multiset combiner. Returns OJE_FULL if the hand is too long,
+// or if the number of multisets or the weight of any one of them doesn't
+// fit in 64 bits.
+int ojc_multiset_new(
+    oj_multiset *mp,
+    oj_cardlist *deck,
+    oj_cardlist *hand,
+    int k,
+    int64_t count)
+{
+    int i, j, v, n;
+    int64_t w;
+
+    assert(0 != mp && 0 != deck && 0 != hand);
+    assert(hand->allocation >= k);
+    assert(deck->length >= k && k >= 0);
+
+    if (hand->pflags & OJF_RDONLY) return OJE_RDONLY;
+    if (hand->pflags & OJF_UNIQUE) return OJE_DUPLICATE;
+    if (k > OJC_MULTISET_MAXK) return OJE_FULL;
+
+    mp->_johnnymoss = 0x10ACE0FF;
+    mp->deck = deck;
+    mp->hand = hand;
+    mp->k = k;
+    mp->flags = _OJC_PENDING;
+
+    // Distinct card values in ascending order, with their multiplicities.
+    memset(mp->mult, 0, sizeof(mp->mult));
+    for (i = 0; i < deck->length; ++i) {
+        assert(deck->cards[i] > 0 && deck->cards[i] <= 54);
+        ++mp->mult[deck->cards[i]];
+    }
+    for (n = 0, i = 1; i < 55; ++i) {
+        mp->index[i] = -1;
+        if (0 == mp->mult[i]) continue;
+        mp->index[i] = n;
+        mp->types[n] = i;
+        mp->mult[n++] = mp->mult[i];
+    }
+    mp->ntypes = n;
+    for (i = n; i < 56; ++i) mp->mult[i] = 0;
+
+    for (j = 0; j <= k; ++j) mp->ways[n][j] = (0 == j);
+    for (i = n - 1; i >= 0; --i) {
+        for (j = 0; j <= k; ++j) {
+            w = 0LL;
+            for (v = 0; v <= j && v <= mp->mult[i]; ++v) {
+                if (w > INT64_MAX - mp->ways[i+1][j-v]) return OJE_FULL;
+                w += mp->ways[i+1][j-v];
+            }
+            mp->ways[i][j] = w;
+        }
+    }
+    if (! _weights_fit(mp, k)) return OJE_FULL;
+    mp->total = mp->ways[0][k];
+    if (0 == count) mp->remaining = mp->total;
+    else mp->remaining = count;
+    mp->rank = 0LL;
+
+    _fill(mp, 0, k);
+    _emit(mp);
+    return 0;
+}
+
+/* Step to the next multiset: take one card away from the rightmost type
+ * that has one to give and whose higher types can absorb it, then pack
+ * everything after that type as low as possible again.
+ */
+int ojc_multiset_next(oj_multiset *mp) {
+    int i, tail = 0, room = 0;
+    assert(0 != mp && 0x10ACE0FF == mp->_johnnymoss);
+
+    if (0 == mp->remaining) return 0;
+
+    if (mp->flags & _OJC_PENDING) {
+        mp->flags &= ~_OJC_PENDING;
+    } else {
+        for (i = mp->ntypes - 2; i >= 0; --i) {
+            tail += mp->counts[i+1];
+            room += mp->mult[i+1];
+            if (mp->counts[i] && room > tail) break;
+        }
+        if (i < 0) {
+            mp->remaining = 0;
+            return 0;
+        }
+        --mp->counts[i];
+        _fill(mp, i + 1, tail + 1);
+        _emit(mp);
+    }
+    --mp->remaining;
+    ++mp->rank;
+    return 1;
+}
+
+// Return rank of given hand, in any order; -1 if it can't come from the
+// deck.
+int64_t ojc_multiset_rank(oj_multiset *mp, oj_cardlist *hand) {
+    int i, v, t, r = mp->k, c[56];
+    int64_t rank = 0LL;
+    assert(0 != mp && 0 != hand);
+
+    if (hand->length != mp->k) return -1LL;
+    memset(c, 0, mp->ntypes * sizeof(int));
+    for (i = 0; i < hand->length; ++i) {
+        if (hand->cards[i] < 1 || hand->cards[i] > 54) return -1LL;
+        if ((t = mp->index[hand->cards[i]]) < 0) return -1LL;
+        if (++c[t] > mp->mult[t]) return -1LL;
+    }
+    for (i = 0; i < mp->ntypes && r > 0; ++i) {
+        for (v = (r < mp->mult[i]) ? r : mp->mult[i]; v > c[i]; --v) {
+            rank += mp->ways[i+1][r - v];
+        }
+        r -= c[i];
+    }
+    return rank;
+}
+
+// Return hand at given rank.
+int ojc_multiset_hand_at(oj_multiset *mp, int64_t rank, oj_cardlist *hand) {
+    int i, v, r = mp->k, c[56];
+    oj_card *hp = hand->cards;
+    assert(0 != mp && 0 != hand);
+
+    if (hand->pflags & OJF_RDONLY) return OJE_RDONLY;
+    if (hand->allocation < mp->k) return OJE_FULL;
+    if (rank < 0 || rank >= mp->total) return OJE_BADINDEX;
+
+    for (i = 0; i < mp->ntypes; ++i) {
+        for (v = (r < mp->mult[i]) ? r : mp->mult[i]; v > 0; --v) {
+            if (rank < mp->ways[i+1][r - v]) break;
+            rank -= mp->ways[i+1][r - v];
+        }
+        c[i] = v;
+        r -= v;
+    }
+    for (i = 0; i < mp->ntypes; ++i) {
+        for (v = 0; v < c[i]; ++v) *hp++ = mp->types[i];
+    }
+    hand->length = mp->k;
+    hand->eflags = 0;
+    return 0;
+}
@@ -18,6 +18,21 @@ extern "C" {
 
 typedef int_fast8_t oj_card;
 
+/* 128-bit integers for counting combinations from big shoes, where 64
+ * bits overflow. GCC and Clang have them on 64-bit targets.
+ */
+#ifdef __SIZEOF_INT128__
+#define OJ_HAVE_INT128 1
+__extension__ typedef __int128 oj_int128;
+__extension__ typedef unsigned __int128 oj_uint128;
+#define OJ_INT128_MAX ((oj_int128)(~(oj_uint128)0 >> 1))
+#endif
+
+// 256-bit unsigned numbers, least significant 64 bits first.
+typedef struct _oj_uint256 {
+    uint64_t w[4];
+} oj_uint256;
+
 typedef enum _oj_rank {
     OJR_DEUCE = 0,  OJR_TWO = 0,
     OJR_TREY = 1,   OJR_THREE = 1,
@@ -63,15 +78,119 @@ typedef struct _oj_cardlist {
 #define OJF_UNIQUE 2
 #define OJF_SORTED 1
 
+// Generator state. The ring holds 64-bit words of output, handed out 16
+// bits at a time from the top down.
+#define OJR_RING_WORDS 256
+
+typedef enum _oj_rng_engine_id {
+    OJR_ENGINE_JKISS = 0,
+    OJR_ENGINE_JKISS4 = 1,
+    OJR_ENGINE_XOSHIRO = 2,
+    OJR_ENGINE_PCG64 = 3,
+    OJR_ENGINE_CHACHA20 = 4,
+    OJR_ENGINE_PHILOX = 5
+} oj_rng_engine_id;
+
+typedef struct _oj_rng_engine_info {
+    int _johnnymoss;
+    int id, available;
+    const char *name, *description;
+    void *filler[4];
+} oj_rng_engine_info;
+
+typedef struct _ojr_lane {
+    uint64_t x, y;
+    uint32_t z1, c1, z2, c2;
+} ojr_lane;
+
+#define OJR_STATE_SIZE 168
+
+typedef struct _ojr_state {
+    int _johnnymoss;
+    int seeded, left, engine;
+    uint64_t x, y;
+    uint32_t z1, c1, z2, c2;
+    uint64_t px, py;
+    uint32_t pz1, pc1, pz2, pc2;
+    ojr_lane lane[4], plane[4];
+    union {
+        uint64_t xo[4];
+        uint64_t pcg[4];
+        uint32_t chacha[16];
+        uint32_t philox[6];
+    } es, pes;
+    union {
+        uint16_t u16[4 * OJR_RING_WORDS];
+        uint32_t u32[2 * OJR_RING_WORDS];
+        uint64_t u64[OJR_RING_WORDS];
+    } ring;
+    void *filler[4];
+} ojr_state;
+
 typedef struct _oj_combiner {
     int _johnnymoss;
     int_fast16_t k, flags;
     oj_cardlist *deck, *hand;
     oj_card map[56], invert[56];
-    int64_t total, remaining;
+    int64_t total, remaining, rank;
+    oj_card out, in, position[56];
+    int_fast16_t slot;
     void *filler[4];
 } oj_combiner;
 
+// Combiner flags
+#define OJC_REVDOOR 1
+
+// Longest hand a multiset combiner can deal.
+#define OJC_MULTISET_MAXK 32
+
+/* Combinations of cards from a deck that may hold several copies of a
+ * card, such as a multi-deck shoe. Each distinct multiset of card values
+ * comes up once; <weight> is the number of ways to deal it from the shoe.
+ */
+typedef struct _oj_multiset {
+    int _johnnymoss;
+    int_fast16_t k, ntypes, flags;
+    oj_cardlist *deck, *hand;
+    int64_t total, remaining, rank, weight;
+    oj_card types[56], index[56];
+    int mult[56], counts[56];
+    int64_t ways[56][OJC_MULTISET_MAXK + 1];
+    void *filler[4];
+} oj_multiset;
+
+// Sampler modes
+#define OJC_SAMPLE_PERMUTE 0
+#define OJC_SAMPLE_STRATIFIED 1
+#define OJC_SAMPLE_LATTICE 2
+
+typedef struct _oj_sampler {
+    int _johnnymoss;
+    int_fast16_t mode, halfbits;
+    oj_combiner *comb;
+    int64_t total, count, index, start, step;
+    uint64_t key[4];
+    void *filler[4];
+} oj_sampler;
+
+#ifdef OJ_HAVE_INT128
+#define OJC_DEALER_MAXGROUPS 8
+
+// Deals of disjoint hands of fixed sizes from one deck.
+typedef struct _oj_dealer {
+    int _johnnymoss;
+    int_fast16_t ngroups, flags;
+    oj_cardlist *deck, *hands[OJC_DEALER_MAXGROUPS];
+    int sizes[OJC_DEALER_MAXGROUPS];
+    int64_t radix[OJC_DEALER_MAXGROUPS];
+    oj_int128 total, remaining, rank;
+    oj_combiner comb[OJC_DEALER_MAXGROUPS];
+    oj_cardlist rest[OJC_DEALER_MAXGROUPS];
+    oj_card restbuf[OJC_DEALER_MAXGROUPS][56];
+    void *filler[4];
+} oj_dealer;
+#endif
+
 typedef struct _oj_poker_hand_info {
     int _johnnymoss;
     int val, group, nranks;
@@ -79,6 +198,29 @@ typedef struct _oj_poker_hand_info {
     void *filler[4];
 } oj_poker_hand_info;
 
+typedef struct _oj_poker_eqclass {
+    int _johnnymoss;
+    int ncards, val;
+    int64_t count;
+    oj_cardlist *hand;
+    void *filler[4];
+} oj_poker_eqclass;
+
+typedef enum _oj_poker_engine_id {
+    OJP_ENGINE_LDC = 0,
+    OJP_ENGINE_SPLIT = 1,
+    OJP_ENGINE_PRIME = 2,
+    OJP_ENGINE_TABLE7 = 3
+} oj_poker_engine_id;
+
+typedef struct _oj_poker_engine_info {
+    int _johnnymoss;
+    int id, current;
+    const char *name, *description;
+    long tablebytes;
+    void *filler[4];
+} oj_poker_engine_info;
+
 
 /* GLOBALS */
 
@@ -95,6 +237,12 @@ typedef struct _oj_poker_hand_info {
 #define OJE_DUPLICATE (-4)
 #define OJE_BADINDEX (-5)
 
+#define OJL_PACKED_SIZE 29
+#define OJC_CHECKPOINT_SIZE (40 + OJR_STATE_SIZE)
+
+#define OJP_NCLASSES 7462
+#define OJP_TABLE7_SIZE 133784560LL
+
 
 /* MACROS */
 
@@ -128,12 +276,47 @@ extern oj_card ojt_val(char *str);
 extern int ojt_vals(char *str, oj_card *arr, int size);
 
 // prng.c
+extern ojr_state *ojr_default_state(void);
+extern int ojr_new(ojr_state *, int);
 extern int ojr_seed(int);
+extern int ojr_seed_r(ojr_state *, int);
+extern int ojr_seed_bytes(const void *, int);
+extern int ojr_seed_bytes_r(ojr_state *, const void *, int);
+extern int ojr_get_state(unsigned char *, int);
+extern int ojr_get_state_r(ojr_state *, unsigned char *, int);
+extern int ojr_set_state(const unsigned char *, int);
+extern int ojr_set_state_r(ojr_state *, const unsigned char *, int);
 extern uint16_t ojr_next16(void);
+extern uint16_t ojr_next16_r(ojr_state *);
 extern uint32_t ojr_next32(void);
+extern uint32_t ojr_next32_r(ojr_state *);
 extern uint64_t ojr_next64(void);
+extern uint64_t ojr_next64_r(ojr_state *);
 extern double ojr_next_double(void);
+extern double ojr_next_double_r(ojr_state *);
 extern int ojr_rand(int);
+extern int ojr_rand_r(ojr_state *, int);
+extern uint32_t ojr_rand32(uint32_t);
+extern uint32_t ojr_rand32_r(ojr_state *, uint32_t);
+extern uint64_t ojr_rand64(uint64_t);
+extern uint64_t ojr_rand64_r(ojr_state *, uint64_t);
+extern int ojr_rand_many(uint32_t, uint32_t *, int);
+extern int ojr_rand_many_r(ojr_state *, uint32_t, uint32_t *, int);
+extern int ojr_rand_descending(uint32_t, uint32_t *, int);
+extern int ojr_rand_descending_r(ojr_state *, uint32_t, uint32_t *, int);
+extern int ojr_set_engine(int);
+extern int ojr_set_engine_r(ojr_state *, int);
+extern int ojr_get_engine(void);
+extern int ojr_get_engine_r(ojr_state *);
+extern int ojr_engine_count(void);
+extern int ojr_engine_info(int, oj_rng_engine_info *);
+extern void ojr_jump(uint64_t);
+extern void ojr_jump_r(ojr_state *, uint64_t);
+extern int ojr_seed_stream(int, uint64_t);
+extern int ojr_seed_stream_r(ojr_state *, int, uint64_t);
+
+// philox.c
+extern void ojr_philox(const uint32_t *, const uint32_t *, uint32_t *);
 
 // cardlist.c
 extern int ojl_new(oj_cardlist *, oj_card *, int);
@@ -153,6 +336,7 @@ extern uint32_t ojl_hash(oj_cardlist *);
 extern oj_card ojl_append(oj_cardlist *, oj_card);
 extern oj_card ojl_pop(oj_cardlist *);
 extern oj_card ojl_pop_random(oj_cardlist *);
+extern oj_card ojl_pop_random_r(oj_cardlist *, ojr_state *);
 extern int ojl_index(oj_cardlist *, oj_card);
 extern int ojl_insert(oj_cardlist *, int, oj_card);
 extern oj_card ojl_delete(oj_cardlist *, int);
@@ -164,26 +348,106 @@ extern int ojl_sort(oj_cardlist *);
 extern int ojl_reverse(oj_cardlist *);
 extern int ojl_fill(oj_cardlist *, int, oj_decktype);
 extern int ojl_shuffle(oj_cardlist *);
+extern int ojl_shuffle_r(oj_cardlist *, ojr_state *);
 extern int ojl_fill_shuffled(oj_cardlist *, oj_decktype);
+extern int ojl_fill_shuffled_r(oj_cardlist *, oj_decktype, ojr_state *);
+extern int ojl_shuffle_batched(oj_cardlist *);
+extern int ojl_shuffle_batched_r(oj_cardlist *, ojr_state *);
+extern int ojl_fill_shuffled_batched(oj_cardlist *, oj_decktype);
+extern int ojl_fill_shuffled_batched_r(oj_cardlist *, oj_decktype, ojr_state *);
+extern int ojl_fill_shuffled_at(oj_cardlist *, oj_decktype, uint64_t, uint64_t);
 extern char *ojl_text(oj_cardlist *, char *, int);
 
+// perm.c
+extern int ojl_perm_rank(oj_cardlist *, oj_uint256 *);
+extern int ojl_perm_unrank(oj_cardlist *, const oj_uint256 *);
+#ifdef OJ_HAVE_INT128
+extern int ojl_perm_rank128(oj_cardlist *, oj_uint128 *);
+extern int ojl_perm_unrank128(oj_cardlist *, oj_uint128);
+#endif
+extern int ojl_kperm_rank(oj_cardlist *, oj_cardlist *, oj_uint256 *);
+extern int ojl_kperm_unrank(oj_cardlist *, int, const oj_uint256 *, oj_cardlist *);
+extern int ojl_pack(oj_cardlist *, unsigned char *);
+extern int ojl_unpack(oj_cardlist *, const unsigned char *);
+
 // combiner.c
 extern int64_t ojc_binomial(int, int);
 extern int ojc_new(oj_combiner *, oj_cardlist *, oj_cardlist *, int, int64_t);
+extern int ojc_new_range(oj_combiner *, oj_cardlist *, oj_cardlist *, int, int64_t, int64_t);
+extern int ojc_chunk(int64_t, int, int, int64_t *, int64_t *);
 extern int ojc_next(oj_combiner *);
+extern int ojc_next_block(oj_combiner *, oj_card *, int);
 extern int ojc_next_random(oj_combiner *);
+extern int ojc_next_random_r(oj_combiner *, ojr_state *);
 extern int64_t ojc_colex_rank(oj_combiner *, oj_cardlist *);
 extern int ojc_colex_hand_at(oj_combiner *, int64_t, oj_cardlist *);
+extern void ojc_colex_rank_many(oj_combiner *, const oj_card *, int, int64_t *);
+extern int ojc_colex_hand_at_many(oj_combiner *, const int64_t *, int, oj_card *);
+extern int64_t ojc_colex_rank7(oj_card *);
+extern int ojc_seek(oj_combiner *, int64_t);
+extern int64_t ojc_tell(oj_combiner *);
+extern int ojc_checkpoint(oj_combiner *, unsigned char *, int);
+extern int ojc_checkpoint_r(oj_combiner *, ojr_state *, unsigned char *, int);
+extern int ojc_restore(oj_combiner *, oj_cardlist *, oj_cardlist *, const unsigned char *, int);
+extern int ojc_restore_r(oj_combiner *, oj_cardlist *, oj_cardlist *, ojr_state *, const unsigned char *, int);
+extern int ojc_new_revdoor(oj_combiner *, oj_cardlist *, oj_cardlist *, int, int64_t);
+extern int64_t ojc_revdoor_rank(oj_combiner *, oj_cardlist *);
+extern int ojc_revdoor_hand_at(oj_combiner *, int64_t, oj_cardlist *);
+#ifdef OJ_HAVE_INT128
+extern oj_int128 ojc_binomial128(int, int);
+extern oj_int128 ojc_colex_rank128(const int *, int);
+extern int ojc_colex_at128(oj_int128, int, int, int *);
+#endif
+
+// multiset.c
+extern int ojc_multiset_new(oj_multiset *, oj_cardlist *, oj_cardlist *, int, int64_t);
+extern int ojc_multiset_next(oj_multiset *);
+extern int64_t ojc_multiset_rank(oj_multiset *, oj_cardlist *);
+extern int ojc_multiset_hand_at(oj_multiset *, int64_t, oj_cardlist *);
+
+// sampler.c
+extern int ojc_sampler_new(oj_sampler *, oj_combiner *, int, int64_t);
+extern int ojc_sampler_new_r(oj_sampler *, oj_combiner *, int, int64_t, ojr_state *);
+extern int64_t ojc_sampler_rank_at(oj_sampler *, int64_t);
+extern int ojc_sampler_next(oj_sampler *);
+
+// dealer.c
+#ifdef OJ_HAVE_INT128
+extern int ojc_dealer_new(oj_dealer *, oj_cardlist *, oj_cardlist **, const int *, int);
+extern int ojc_dealer_next(oj_dealer *);
+extern oj_int128 ojc_dealer_rank(oj_dealer *, oj_cardlist **);
+extern int ojc_dealer_deal_at(oj_dealer *, oj_int128, oj_cardlist **);
+#endif
 
 // blackjack.c
 extern int ojb_total(oj_cardlist *);
 
 // poker.c
+extern int ojp_set_engine(int);
+extern int ojp_get_engine(void);
+extern int ojp_engine_count(void);
+extern int ojp_engine_info(int, oj_poker_engine_info *);
 extern int ojp_eval5(oj_cardlist *);
 extern int ojp_eval7(oj_cardlist *);
+extern int ojp_eval5_many(oj_card *, int, int *);
+extern int ojp_eval7_many(oj_card *, int, int *);
 extern int ojp_best5(oj_cardlist *, oj_cardlist *);
 extern int ojp_hand_info(oj_poker_hand_info *, oj_cardlist *, int val);
 extern char *ojp_hand_description(oj_poker_hand_info *, char *, int);
+extern int ojp_eqclass_new(oj_poker_eqclass *, oj_cardlist *, int);
+extern int ojp_eqclass_next(oj_poker_eqclass *);
+extern int64_t ojp_eqclass_count(int, int);
+
+// pokersplit.c
+extern int ojp_eval5_split(oj_cardlist *);
+extern int ojp_eval7_split(oj_cardlist *);
+extern int ojp_eval_mask(uint64_t);
+extern int ojp_eval_mask_many(uint64_t *, int, int *);
+
+// pokertable7.c
+extern int ojp_table7_build(const char *);
+extern int ojp_table7_load(const char *);
+extern int ojp_table7_unload(void);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,577 @@
+/* OneJoker library <http://lcrocker.github.io/OneJoker>
+ * Dense Pascal's triangle: _pascal[n][k] = (n choose k) for n, k < 64.
+ * Entries with k > n are zero. Every entry fits in a signed 64-bit value.
+ * This file is automatically generated.
+ */
+
+static const int64_t _pascal[64][64] = {
+    { 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 2LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 3LL, 3LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 4LL, 6LL, 4LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 5LL, 10LL, 10LL, 5LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 6LL, 15LL, 20LL, 15LL, 6LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 7LL, 21LL, 35LL, 35LL, 21LL, 7LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 8LL, 28LL, 56LL, 70LL, 56LL, 28LL, 8LL, 1LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 9LL, 36LL, 84LL, 126LL, 126LL, 84LL, 36LL, 9LL, 1LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 10LL, 45LL, 120LL, 210LL, 252LL, 210LL, 120LL, 45LL, 10LL, 1LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 11LL, 55LL, 165LL, 330LL, 462LL, 462LL, 330LL, 165LL, 55LL, 11LL,
+      1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 12LL, 66LL, 220LL, 495LL, 792LL, 924LL, 792LL, 495LL, 220LL, 66LL,
+      12LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 13LL, 78LL, 286LL, 715LL, 1287LL, 1716LL, 1716LL, 1287LL, 715LL,
+      286LL, 78LL, 13LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 14LL, 91LL, 364LL, 1001LL, 2002LL, 3003LL, 3432LL, 3003LL, 2002LL,
+      1001LL, 364LL, 91LL, 14LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 15LL, 105LL, 455LL, 1365LL, 3003LL, 5005LL, 6435LL, 6435LL, 5005LL,
+      3003LL, 1365LL, 455LL, 105LL, 15LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 16LL, 120LL, 560LL, 1820LL, 4368LL, 8008LL, 11440LL, 12870LL,
+      11440LL, 8008LL, 4368LL, 1820LL, 560LL, 120LL, 16LL, 1LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL },
+    { 1LL, 17LL, 136LL, 680LL, 2380LL, 6188LL, 12376LL, 19448LL, 24310LL,
+      24310LL, 19448LL, 12376LL, 6188LL, 2380LL, 680LL, 136LL, 17LL, 1LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL },
+    { 1LL, 18LL, 153LL, 816LL, 3060LL, 8568LL, 18564LL, 31824LL, 43758LL,
+      48620LL, 43758LL, 31824LL, 18564LL, 8568LL, 3060LL, 816LL, 153LL, 18LL,
+      1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL },
+    { 1LL, 19LL, 171LL, 969LL, 3876LL, 11628LL, 27132LL, 50388LL, 75582LL,
+      92378LL, 92378LL, 75582LL, 50388LL, 27132LL, 11628LL, 3876LL, 969LL,
+      171LL, 19LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 20LL, 190LL, 1140LL, 4845LL, 15504LL, 38760LL, 77520LL, 125970LL,
+      167960LL, 184756LL, 167960LL, 125970LL, 77520LL, 38760LL, 15504LL,
+      4845LL, 1140LL, 190LL, 20LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 21LL, 210LL, 1330LL, 5985LL, 20349LL, 54264LL, 116280LL, 203490LL,
+      293930LL, 352716LL, 352716LL, 293930LL, 203490LL, 116280LL, 54264LL,
+      20349LL, 5985LL, 1330LL, 210LL, 21LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 22LL, 231LL, 1540LL, 7315LL, 26334LL, 74613LL, 170544LL, 319770LL,
+      497420LL, 646646LL, 705432LL, 646646LL, 497420LL, 319770LL, 170544LL,
+      74613LL, 26334LL, 7315LL, 1540LL, 231LL, 22LL, 1LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 23LL, 253LL, 1771LL, 8855LL, 33649LL, 100947LL, 245157LL, 490314LL,
+      817190LL, 1144066LL, 1352078LL, 1352078LL, 1144066LL, 817190LL,
+      490314LL, 245157LL, 100947LL, 33649LL, 8855LL, 1771LL, 253LL, 23LL, 1LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 24LL, 276LL, 2024LL, 10626LL, 42504LL, 134596LL, 346104LL,
+      735471LL, 1307504LL, 1961256LL, 2496144LL, 2704156LL, 2496144LL,
+      1961256LL, 1307504LL, 735471LL, 346104LL, 134596LL, 42504LL, 10626LL,
+      2024LL, 276LL, 24LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL },
+    { 1LL, 25LL, 300LL, 2300LL, 12650LL, 53130LL, 177100LL, 480700LL,
+      1081575LL, 2042975LL, 3268760LL, 4457400LL, 5200300LL, 5200300LL,
+      4457400LL, 3268760LL, 2042975LL, 1081575LL, 480700LL, 177100LL, 53130LL,
+      12650LL, 2300LL, 300LL, 25LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL },
+    { 1LL, 26LL, 325LL, 2600LL, 14950LL, 65780LL, 230230LL, 657800LL,
+      1562275LL, 3124550LL, 5311735LL, 7726160LL, 9657700LL, 10400600LL,
+      9657700LL, 7726160LL, 5311735LL, 3124550LL, 1562275LL, 657800LL,
+      230230LL, 65780LL, 14950LL, 2600LL, 325LL, 26LL, 1LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 27LL, 351LL, 2925LL, 17550LL, 80730LL, 296010LL, 888030LL,
+      2220075LL, 4686825LL, 8436285LL, 13037895LL, 17383860LL, 20058300LL,
+      20058300LL, 17383860LL, 13037895LL, 8436285LL, 4686825LL, 2220075LL,
+      888030LL, 296010LL, 80730LL, 17550LL, 2925LL, 351LL, 27LL, 1LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 28LL, 378LL, 3276LL, 20475LL, 98280LL, 376740LL, 1184040LL,
+      3108105LL, 6906900LL, 13123110LL, 21474180LL, 30421755LL, 37442160LL,
+      40116600LL, 37442160LL, 30421755LL, 21474180LL, 13123110LL, 6906900LL,
+      3108105LL, 1184040LL, 376740LL, 98280LL, 20475LL, 3276LL, 378LL, 28LL,
+      1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 29LL, 406LL, 3654LL, 23751LL, 118755LL, 475020LL, 1560780LL,
+      4292145LL, 10015005LL, 20030010LL, 34597290LL, 51895935LL, 67863915LL,
+      77558760LL, 77558760LL, 67863915LL, 51895935LL, 34597290LL, 20030010LL,
+      10015005LL, 4292145LL, 1560780LL, 475020LL, 118755LL, 23751LL, 3654LL,
+      406LL, 29LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 30LL, 435LL, 4060LL, 27405LL, 142506LL, 593775LL, 2035800LL,
+      5852925LL, 14307150LL, 30045015LL, 54627300LL, 86493225LL, 119759850LL,
+      145422675LL, 155117520LL, 145422675LL, 119759850LL, 86493225LL,
+      54627300LL, 30045015LL, 14307150LL, 5852925LL, 2035800LL, 593775LL,
+      142506LL, 27405LL, 4060LL, 435LL, 30LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 31LL, 465LL, 4495LL, 31465LL, 169911LL, 736281LL, 2629575LL,
+      7888725LL, 20160075LL, 44352165LL, 84672315LL, 141120525LL, 206253075LL,
+      265182525LL, 300540195LL, 300540195LL, 265182525LL, 206253075LL,
+      141120525LL, 84672315LL, 44352165LL, 20160075LL, 7888725LL, 2629575LL,
+      736281LL, 169911LL, 31465LL, 4495LL, 465LL, 31LL, 1LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL },
+    { 1LL, 32LL, 496LL, 4960LL, 35960LL, 201376LL, 906192LL, 3365856LL,
+      10518300LL, 28048800LL, 64512240LL, 129024480LL, 225792840LL,
+      347373600LL, 471435600LL, 565722720LL, 601080390LL, 565722720LL,
+      471435600LL, 347373600LL, 225792840LL, 129024480LL, 64512240LL,
+      28048800LL, 10518300LL, 3365856LL, 906192LL, 201376LL, 35960LL, 4960LL,
+      496LL, 32LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 33LL, 528LL, 5456LL, 40920LL, 237336LL, 1107568LL, 4272048LL,
+      13884156LL, 38567100LL, 92561040LL, 193536720LL, 354817320LL,
+      573166440LL, 818809200LL, 1037158320LL, 1166803110LL, 1166803110LL,
+      1037158320LL, 818809200LL, 573166440LL, 354817320LL, 193536720LL,
+      92561040LL, 38567100LL, 13884156LL, 4272048LL, 1107568LL, 237336LL,
+      40920LL, 5456LL, 528LL, 33LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 34LL, 561LL, 5984LL, 46376LL, 278256LL, 1344904LL, 5379616LL,
+      18156204LL, 52451256LL, 131128140LL, 286097760LL, 548354040LL,
+      927983760LL, 1391975640LL, 1855967520LL, 2203961430LL, 2333606220LL,
+      2203961430LL, 1855967520LL, 1391975640LL, 927983760LL, 548354040LL,
+      286097760LL, 131128140LL, 52451256LL, 18156204LL, 5379616LL, 1344904LL,
+      278256LL, 46376LL, 5984LL, 561LL, 34LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 35LL, 595LL, 6545LL, 52360LL, 324632LL, 1623160LL, 6724520LL,
+      23535820LL, 70607460LL, 183579396LL, 417225900LL, 834451800LL,
+      1476337800LL, 2319959400LL, 3247943160LL, 4059928950LL, 4537567650LL,
+      4537567650LL, 4059928950LL, 3247943160LL, 2319959400LL, 1476337800LL,
+      834451800LL, 417225900LL, 183579396LL, 70607460LL, 23535820LL,
+      6724520LL, 1623160LL, 324632LL, 52360LL, 6545LL, 595LL, 35LL, 1LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 36LL, 630LL, 7140LL, 58905LL, 376992LL, 1947792LL, 8347680LL,
+      30260340LL, 94143280LL, 254186856LL, 600805296LL, 1251677700LL,
+      2310789600LL, 3796297200LL, 5567902560LL, 7307872110LL, 8597496600LL,
+      9075135300LL, 8597496600LL, 7307872110LL, 5567902560LL, 3796297200LL,
+      2310789600LL, 1251677700LL, 600805296LL, 254186856LL, 94143280LL,
+      30260340LL, 8347680LL, 1947792LL, 376992LL, 58905LL, 7140LL, 630LL,
+      36LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL },
+    { 1LL, 37LL, 666LL, 7770LL, 66045LL, 435897LL, 2324784LL, 10295472LL,
+      38608020LL, 124403620LL, 348330136LL, 854992152LL, 1852482996LL,
+      3562467300LL, 6107086800LL, 9364199760LL, 12875774670LL, 15905368710LL,
+      17672631900LL, 17672631900LL, 15905368710LL, 12875774670LL,
+      9364199760LL, 6107086800LL, 3562467300LL, 1852482996LL, 854992152LL,
+      348330136LL, 124403620LL, 38608020LL, 10295472LL, 2324784LL, 435897LL,
+      66045LL, 7770LL, 666LL, 37LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 38LL, 703LL, 8436LL, 73815LL, 501942LL, 2760681LL, 12620256LL,
+      48903492LL, 163011640LL, 472733756LL, 1203322288LL, 2707475148LL,
+      5414950296LL, 9669554100LL, 15471286560LL, 22239974430LL, 28781143380LL,
+      33578000610LL, 35345263800LL, 33578000610LL, 28781143380LL,
+      22239974430LL, 15471286560LL, 9669554100LL, 5414950296LL, 2707475148LL,
+      1203322288LL, 472733756LL, 163011640LL, 48903492LL, 12620256LL,
+      2760681LL, 501942LL, 73815LL, 8436LL, 703LL, 38LL, 1LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 39LL, 741LL, 9139LL, 82251LL, 575757LL, 3262623LL, 15380937LL,
+      61523748LL, 211915132LL, 635745396LL, 1676056044LL, 3910797436LL,
+      8122425444LL, 15084504396LL, 25140840660LL, 37711260990LL,
+      51021117810LL, 62359143990LL, 68923264410LL, 68923264410LL,
+      62359143990LL, 51021117810LL, 37711260990LL, 25140840660LL,
+      15084504396LL, 8122425444LL, 3910797436LL, 1676056044LL, 635745396LL,
+      211915132LL, 61523748LL, 15380937LL, 3262623LL, 575757LL, 82251LL,
+      9139LL, 741LL, 39LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL },
+    { 1LL, 40LL, 780LL, 9880LL, 91390LL, 658008LL, 3838380LL, 18643560LL,
+      76904685LL, 273438880LL, 847660528LL, 2311801440LL, 5586853480LL,
+      12033222880LL, 23206929840LL, 40225345056LL, 62852101650LL,
+      88732378800LL, 113380261800LL, 131282408400LL, 137846528820LL,
+      131282408400LL, 113380261800LL, 88732378800LL, 62852101650LL,
+      40225345056LL, 23206929840LL, 12033222880LL, 5586853480LL, 2311801440LL,
+      847660528LL, 273438880LL, 76904685LL, 18643560LL, 3838380LL, 658008LL,
+      91390LL, 9880LL, 780LL, 40LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL },
+    { 1LL, 41LL, 820LL, 10660LL, 101270LL, 749398LL, 4496388LL, 22481940LL,
+      95548245LL, 350343565LL, 1121099408LL, 3159461968LL, 7898654920LL,
+      17620076360LL, 35240152720LL, 63432274896LL, 103077446706LL,
+      151584480450LL, 202112640600LL, 244662670200LL, 269128937220LL,
+      269128937220LL, 244662670200LL, 202112640600LL, 151584480450LL,
+      103077446706LL, 63432274896LL, 35240152720LL, 17620076360LL,
+      7898654920LL, 3159461968LL, 1121099408LL, 350343565LL, 95548245LL,
+      22481940LL, 4496388LL, 749398LL, 101270LL, 10660LL, 820LL, 41LL, 1LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 42LL, 861LL, 11480LL, 111930LL, 850668LL, 5245786LL, 26978328LL,
+      118030185LL, 445891810LL, 1471442973LL, 4280561376LL, 11058116888LL,
+      25518731280LL, 52860229080LL, 98672427616LL, 166509721602LL,
+      254661927156LL, 353697121050LL, 446775310800LL, 513791607420LL,
+      538257874440LL, 513791607420LL, 446775310800LL, 353697121050LL,
+      254661927156LL, 166509721602LL, 98672427616LL, 52860229080LL,
+      25518731280LL, 11058116888LL, 4280561376LL, 1471442973LL, 445891810LL,
+      118030185LL, 26978328LL, 5245786LL, 850668LL, 111930LL, 11480LL, 861LL,
+      42LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 43LL, 903LL, 12341LL, 123410LL, 962598LL, 6096454LL, 32224114LL,
+      145008513LL, 563921995LL, 1917334783LL, 5752004349LL, 15338678264LL,
+      36576848168LL, 78378960360LL, 151532656696LL, 265182149218LL,
+      421171648758LL, 608359048206LL, 800472431850LL, 960566918220LL,
+      1052049481860LL, 1052049481860LL, 960566918220LL, 800472431850LL,
+      608359048206LL, 421171648758LL, 265182149218LL, 151532656696LL,
+      78378960360LL, 36576848168LL, 15338678264LL, 5752004349LL, 1917334783LL,
+      563921995LL, 145008513LL, 32224114LL, 6096454LL, 962598LL, 123410LL,
+      12341LL, 903LL, 43LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 44LL, 946LL, 13244LL, 135751LL, 1086008LL, 7059052LL, 38320568LL,
+      177232627LL, 708930508LL, 2481256778LL, 7669339132LL, 21090682613LL,
+      51915526432LL, 114955808528LL, 229911617056LL, 416714805914LL,
+      686353797976LL, 1029530696964LL, 1408831480056LL, 1761039350070LL,
+      2012616400080LL, 2104098963720LL, 2012616400080LL, 1761039350070LL,
+      1408831480056LL, 1029530696964LL, 686353797976LL, 416714805914LL,
+      229911617056LL, 114955808528LL, 51915526432LL, 21090682613LL,
+      7669339132LL, 2481256778LL, 708930508LL, 177232627LL, 38320568LL,
+      7059052LL, 1086008LL, 135751LL, 13244LL, 946LL, 44LL, 1LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL },
+    { 1LL, 45LL, 990LL, 14190LL, 148995LL, 1221759LL, 8145060LL, 45379620LL,
+      215553195LL, 886163135LL, 3190187286LL, 10150595910LL, 28760021745LL,
+      73006209045LL, 166871334960LL, 344867425584LL, 646626422970LL,
+      1103068603890LL, 1715884494940LL, 2438362177020LL, 3169870830126LL,
+      3773655750150LL, 4116715363800LL, 4116715363800LL, 3773655750150LL,
+      3169870830126LL, 2438362177020LL, 1715884494940LL, 1103068603890LL,
+      646626422970LL, 344867425584LL, 166871334960LL, 73006209045LL,
+      28760021745LL, 10150595910LL, 3190187286LL, 886163135LL, 215553195LL,
+      45379620LL, 8145060LL, 1221759LL, 148995LL, 14190LL, 990LL, 45LL, 1LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL },
+    { 1LL, 46LL, 1035LL, 15180LL, 163185LL, 1370754LL, 9366819LL, 53524680LL,
+      260932815LL, 1101716330LL, 4076350421LL, 13340783196LL, 38910617655LL,
+      101766230790LL, 239877544005LL, 511738760544LL, 991493848554LL,
+      1749695026860LL, 2818953098830LL, 4154246671960LL, 5608233007146LL,
+      6943526580276LL, 7890371113950LL, 8233430727600LL, 7890371113950LL,
+      6943526580276LL, 5608233007146LL, 4154246671960LL, 2818953098830LL,
+      1749695026860LL, 991493848554LL, 511738760544LL, 239877544005LL,
+      101766230790LL, 38910617655LL, 13340783196LL, 4076350421LL,
+      1101716330LL, 260932815LL, 53524680LL, 9366819LL, 1370754LL, 163185LL,
+      15180LL, 1035LL, 46LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 47LL, 1081LL, 16215LL, 178365LL, 1533939LL, 10737573LL, 62891499LL,
+      314457495LL, 1362649145LL, 5178066751LL, 17417133617LL, 52251400851LL,
+      140676848445LL, 341643774795LL, 751616304549LL, 1503232609098LL,
+      2741188875414LL, 4568648125690LL, 6973199770790LL, 9762479679106LL,
+      12551759587422LL, 14833897694226LL, 16123801841550LL, 16123801841550LL,
+      14833897694226LL, 12551759587422LL, 9762479679106LL, 6973199770790LL,
+      4568648125690LL, 2741188875414LL, 1503232609098LL, 751616304549LL,
+      341643774795LL, 140676848445LL, 52251400851LL, 17417133617LL,
+      5178066751LL, 1362649145LL, 314457495LL, 62891499LL, 10737573LL,
+      1533939LL, 178365LL, 16215LL, 1081LL, 47LL, 1LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 48LL, 1128LL, 17296LL, 194580LL, 1712304LL, 12271512LL, 73629072LL,
+      377348994LL, 1677106640LL, 6540715896LL, 22595200368LL, 69668534468LL,
+      192928249296LL, 482320623240LL, 1093260079344LL, 2254848913647LL,
+      4244421484512LL, 7309837001104LL, 11541847896480LL, 16735679449896LL,
+      22314239266528LL, 27385657281648LL, 30957699535776LL, 32247603683100LL,
+      30957699535776LL, 27385657281648LL, 22314239266528LL, 16735679449896LL,
+      11541847896480LL, 7309837001104LL, 4244421484512LL, 2254848913647LL,
+      1093260079344LL, 482320623240LL, 192928249296LL, 69668534468LL,
+      22595200368LL, 6540715896LL, 1677106640LL, 377348994LL, 73629072LL,
+      12271512LL, 1712304LL, 194580LL, 17296LL, 1128LL, 48LL, 1LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 49LL, 1176LL, 18424LL, 211876LL, 1906884LL, 13983816LL, 85900584LL,
+      450978066LL, 2054455634LL, 8217822536LL, 29135916264LL, 92263734836LL,
+      262596783764LL, 675248872536LL, 1575580702584LL, 3348108992991LL,
+      6499270398159LL, 11554258485616LL, 18851684897584LL, 28277527346376LL,
+      39049918716424LL, 49699896548176LL, 58343356817424LL, 63205303218876LL,
+      63205303218876LL, 58343356817424LL, 49699896548176LL, 39049918716424LL,
+      28277527346376LL, 18851684897584LL, 11554258485616LL, 6499270398159LL,
+      3348108992991LL, 1575580702584LL, 675248872536LL, 262596783764LL,
+      92263734836LL, 29135916264LL, 8217822536LL, 2054455634LL, 450978066LL,
+      85900584LL, 13983816LL, 1906884LL, 211876LL, 18424LL, 1176LL, 49LL, 1LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 50LL, 1225LL, 19600LL, 230300LL, 2118760LL, 15890700LL, 99884400LL,
+      536878650LL, 2505433700LL, 10272278170LL, 37353738800LL, 121399651100LL,
+      354860518600LL, 937845656300LL, 2250829575120LL, 4923689695575LL,
+      9847379391150LL, 18053528883775LL, 30405943383200LL, 47129212243960LL,
+      67327446062800LL, 88749815264600LL, 108043253365600LL,
+      121548660036300LL, 126410606437752LL, 121548660036300LL,
+      108043253365600LL, 88749815264600LL, 67327446062800LL, 47129212243960LL,
+      30405943383200LL, 18053528883775LL, 9847379391150LL, 4923689695575LL,
+      2250829575120LL, 937845656300LL, 354860518600LL, 121399651100LL,
+      37353738800LL, 10272278170LL, 2505433700LL, 536878650LL, 99884400LL,
+      15890700LL, 2118760LL, 230300LL, 19600LL, 1225LL, 50LL, 1LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 51LL, 1275LL, 20825LL, 249900LL, 2349060LL, 18009460LL,
+      115775100LL, 636763050LL, 3042312350LL, 12777711870LL, 47626016970LL,
+      158753389900LL, 476260169700LL, 1292706174900LL, 3188675231420LL,
+      7174519270695LL, 14771069086725LL, 27900908274925LL, 48459472266975LL,
+      77535155627160LL, 114456658306760LL, 156077261327400LL,
+      196793068630200LL, 229591913401900LL, 247959266474052LL,
+      247959266474052LL, 229591913401900LL, 196793068630200LL,
+      156077261327400LL, 114456658306760LL, 77535155627160LL,
+      48459472266975LL, 27900908274925LL, 14771069086725LL, 7174519270695LL,
+      3188675231420LL, 1292706174900LL, 476260169700LL, 158753389900LL,
+      47626016970LL, 12777711870LL, 3042312350LL, 636763050LL, 115775100LL,
+      18009460LL, 2349060LL, 249900LL, 20825LL, 1275LL, 51LL, 1LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 52LL, 1326LL, 22100LL, 270725LL, 2598960LL, 20358520LL,
+      133784560LL, 752538150LL, 3679075400LL, 15820024220LL, 60403728840LL,
+      206379406870LL, 635013559600LL, 1768966344600LL, 4481381406320LL,
+      10363194502115LL, 21945588357420LL, 42671977361650LL, 76360380541900LL,
+      125994627894135LL, 191991813933920LL, 270533919634160LL,
+      352870329957600LL, 426384982032100LL, 477551179875952LL,
+      495918532948104LL, 477551179875952LL, 426384982032100LL,
+      352870329957600LL, 270533919634160LL, 191991813933920LL,
+      125994627894135LL, 76360380541900LL, 42671977361650LL, 21945588357420LL,
+      10363194502115LL, 4481381406320LL, 1768966344600LL, 635013559600LL,
+      206379406870LL, 60403728840LL, 15820024220LL, 3679075400LL, 752538150LL,
+      133784560LL, 20358520LL, 2598960LL, 270725LL, 22100LL, 1326LL, 52LL,
+      1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 53LL, 1378LL, 23426LL, 292825LL, 2869685LL, 22957480LL,
+      154143080LL, 886322710LL, 4431613550LL, 19499099620LL, 76223753060LL,
+      266783135710LL, 841392966470LL, 2403979904200LL, 6250347750920LL,
+      14844575908435LL, 32308782859535LL, 64617565719070LL, 119032357903550LL,
+      202355008436035LL, 317986441828055LL, 462525733568080LL,
+      623404249591760LL, 779255311989700LL, 903936161908052LL,
+      973469712824056LL, 973469712824056LL, 903936161908052LL,
+      779255311989700LL, 623404249591760LL, 462525733568080LL,
+      317986441828055LL, 202355008436035LL, 119032357903550LL,
+      64617565719070LL, 32308782859535LL, 14844575908435LL, 6250347750920LL,
+      2403979904200LL, 841392966470LL, 266783135710LL, 76223753060LL,
+      19499099620LL, 4431613550LL, 886322710LL, 154143080LL, 22957480LL,
+      2869685LL, 292825LL, 23426LL, 1378LL, 53LL, 1LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 54LL, 1431LL, 24804LL, 316251LL, 3162510LL, 25827165LL,
+      177100560LL, 1040465790LL, 5317936260LL, 23930713170LL, 95722852680LL,
+      343006888770LL, 1108176102180LL, 3245372870670LL, 8654327655120LL,
+      21094923659355LL, 47153358767970LL, 96926348578605LL, 183649923622620LL,
+      321387366339585LL, 520341450264090LL, 780512175396135LL,
+      1085929983159840LL, 1402659561581460LL, 1683191473897752LL,
+      1877405874732108LL, 1946939425648112LL, 1877405874732108LL,
+      1683191473897752LL, 1402659561581460LL, 1085929983159840LL,
+      780512175396135LL, 520341450264090LL, 321387366339585LL,
+      183649923622620LL, 96926348578605LL, 47153358767970LL, 21094923659355LL,
+      8654327655120LL, 3245372870670LL, 1108176102180LL, 343006888770LL,
+      95722852680LL, 23930713170LL, 5317936260LL, 1040465790LL, 177100560LL,
+      25827165LL, 3162510LL, 316251LL, 24804LL, 1431LL, 54LL, 1LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 55LL, 1485LL, 26235LL, 341055LL, 3478761LL, 28989675LL,
+      202927725LL, 1217566350LL, 6358402050LL, 29248649430LL, 119653565850LL,
+      438729741450LL, 1451182990950LL, 4353548972850LL, 11899700525790LL,
+      29749251314475LL, 68248282427325LL, 144079707346575LL,
+      280576272201225LL, 505037289962205LL, 841728816603675LL,
+      1300853625660225LL, 1866442158555975LL, 2488589544741300LL,
+      3085851035479212LL, 3560597348629860LL, 3824345300380220LL,
+      3824345300380220LL, 3560597348629860LL, 3085851035479212LL,
+      2488589544741300LL, 1866442158555975LL, 1300853625660225LL,
+      841728816603675LL, 505037289962205LL, 280576272201225LL,
+      144079707346575LL, 68248282427325LL, 29749251314475LL, 11899700525790LL,
+      4353548972850LL, 1451182990950LL, 438729741450LL, 119653565850LL,
+      29248649430LL, 6358402050LL, 1217566350LL, 202927725LL, 28989675LL,
+      3478761LL, 341055LL, 26235LL, 1485LL, 55LL, 1LL, 0LL, 0LL, 0LL, 0LL,
+      0LL, 0LL, 0LL, 0LL },
+    { 1LL, 56LL, 1540LL, 27720LL, 367290LL, 3819816LL, 32468436LL,
+      231917400LL, 1420494075LL, 7575968400LL, 35607051480LL, 148902215280LL,
+      558383307300LL, 1889912732400LL, 5804731963800LL, 16253249498640LL,
+      41648951840265LL, 97997533741800LL, 212327989773900LL,
+      424655979547800LL, 785613562163430LL, 1346766106565880LL,
+      2142582442263900LL, 3167295784216200LL, 4355031703297275LL,
+      5574440580220512LL, 6646448384109072LL, 7384942649010080LL,
+      7648690600760440LL, 7384942649010080LL, 6646448384109072LL,
+      5574440580220512LL, 4355031703297275LL, 3167295784216200LL,
+      2142582442263900LL, 1346766106565880LL, 785613562163430LL,
+      424655979547800LL, 212327989773900LL, 97997533741800LL,
+      41648951840265LL, 16253249498640LL, 5804731963800LL, 1889912732400LL,
+      558383307300LL, 148902215280LL, 35607051480LL, 7575968400LL,
+      1420494075LL, 231917400LL, 32468436LL, 3819816LL, 367290LL, 27720LL,
+      1540LL, 56LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 57LL, 1596LL, 29260LL, 395010LL, 4187106LL, 36288252LL,
+      264385836LL, 1652411475LL, 8996462475LL, 43183019880LL, 184509266760LL,
+      707285522580LL, 2448296039700LL, 7694644696200LL, 22057981462440LL,
+      57902201338905LL, 139646485582065LL, 310325523515700LL,
+      636983969321700LL, 1210269541711230LL, 2132379668729310LL,
+      3489348548829780LL, 5309878226480100LL, 7522327487513475LL,
+      9929472283517787LL, 12220888964329584LL, 14031391033119152LL,
+      15033633249770520LL, 15033633249770520LL, 14031391033119152LL,
+      12220888964329584LL, 9929472283517787LL, 7522327487513475LL,
+      5309878226480100LL, 3489348548829780LL, 2132379668729310LL,
+      1210269541711230LL, 636983969321700LL, 310325523515700LL,
+      139646485582065LL, 57902201338905LL, 22057981462440LL, 7694644696200LL,
+      2448296039700LL, 707285522580LL, 184509266760LL, 43183019880LL,
+      8996462475LL, 1652411475LL, 264385836LL, 36288252LL, 4187106LL,
+      395010LL, 29260LL, 1596LL, 57LL, 1LL, 0LL, 0LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 58LL, 1653LL, 30856LL, 424270LL, 4582116LL, 40475358LL,
+      300674088LL, 1916797311LL, 10648873950LL, 52179482355LL, 227692286640LL,
+      891794789340LL, 3155581562280LL, 10142940735900LL, 29752626158640LL,
+      79960182801345LL, 197548686920970LL, 449972009097765LL,
+      947309492837400LL, 1847253511032930LL, 3342649210440540LL,
+      5621728217559090LL, 8799226775309880LL, 12832205713993575LL,
+      17451799771031262LL, 22150361247847371LL, 26252279997448736LL,
+      29065024282889672LL, 30067266499541040LL, 29065024282889672LL,
+      26252279997448736LL, 22150361247847371LL, 17451799771031262LL,
+      12832205713993575LL, 8799226775309880LL, 5621728217559090LL,
+      3342649210440540LL, 1847253511032930LL, 947309492837400LL,
+      449972009097765LL, 197548686920970LL, 79960182801345LL,
+      29752626158640LL, 10142940735900LL, 3155581562280LL, 891794789340LL,
+      227692286640LL, 52179482355LL, 10648873950LL, 1916797311LL, 300674088LL,
+      40475358LL, 4582116LL, 424270LL, 30856LL, 1653LL, 58LL, 1LL, 0LL, 0LL,
+      0LL, 0LL, 0LL },
+    { 1LL, 59LL, 1711LL, 32509LL, 455126LL, 5006386LL, 45057474LL,
+      341149446LL, 2217471399LL, 12565671261LL, 62828356305LL, 279871768995LL,
+      1119487075980LL, 4047376351620LL, 13298522298180LL, 39895566894540LL,
+      109712808959985LL, 277508869722315LL, 647520696018735LL,
+      1397281501935165LL, 2794563003870330LL, 5189902721473470LL,
+      8964377427999630LL, 14420954992868970LL, 21631432489303455LL,
+      30284005485024837LL, 39602161018878633LL, 48402641245296107LL,
+      55317304280338408LL, 59132290782430712LL, 59132290782430712LL,
+      55317304280338408LL, 48402641245296107LL, 39602161018878633LL,
+      30284005485024837LL, 21631432489303455LL, 14420954992868970LL,
+      8964377427999630LL, 5189902721473470LL, 2794563003870330LL,
+      1397281501935165LL, 647520696018735LL, 277508869722315LL,
+      109712808959985LL, 39895566894540LL, 13298522298180LL, 4047376351620LL,
+      1119487075980LL, 279871768995LL, 62828356305LL, 12565671261LL,
+      2217471399LL, 341149446LL, 45057474LL, 5006386LL, 455126LL, 32509LL,
+      1711LL, 59LL, 1LL, 0LL, 0LL, 0LL, 0LL },
+    { 1LL, 60LL, 1770LL, 34220LL, 487635LL, 5461512LL, 50063860LL,
+      386206920LL, 2558620845LL, 14783142660LL, 75394027566LL, 342700125300LL,
+      1399358844975LL, 5166863427600LL, 17345898649800LL, 53194089192720LL,
+      149608375854525LL, 387221678682300LL, 925029565741050LL,
+      2044802197953900LL, 4191844505805495LL, 7984465725343800LL,
+      14154280149473100LL, 23385332420868600LL, 36052387482172425LL,
+      51915437974328292LL, 69886166503903470LL, 88004802264174740LL,
+      103719945525634515LL, 114449595062769120LL, 118264581564861424LL,
+      114449595062769120LL, 103719945525634515LL, 88004802264174740LL,
+      69886166503903470LL, 51915437974328292LL, 36052387482172425LL,
+      23385332420868600LL, 14154280149473100LL, 7984465725343800LL,
+      4191844505805495LL, 2044802197953900LL, 925029565741050LL,
+      387221678682300LL, 149608375854525LL, 53194089192720LL,
+      17345898649800LL, 5166863427600LL, 1399358844975LL, 342700125300LL,
+      75394027566LL, 14783142660LL, 2558620845LL, 386206920LL, 50063860LL,
+      5461512LL, 487635LL, 34220LL, 1770LL, 60LL, 1LL, 0LL, 0LL, 0LL },
+    { 1LL, 61LL, 1830LL, 35990LL, 521855LL, 5949147LL, 55525372LL,
+      436270780LL, 2944827765LL, 17341763505LL, 90177170226LL, 418094152866LL,
+      1742058970275LL, 6566222272575LL, 22512762077400LL, 70539987842520LL,
+      202802465047245LL, 536830054536825LL, 1312251244423350LL,
+      2969831763694950LL, 6236646703759395LL, 12176310231149295LL,
+      22138745874816900LL, 37539612570341700LL, 59437719903041025LL,
+      87967825456500717LL, 121801604478231762LL, 157890968768078210LL,
+      191724747789809255LL, 218169540588403635LL, 232714176627630544LL,
+      232714176627630544LL, 218169540588403635LL, 191724747789809255LL,
+      157890968768078210LL, 121801604478231762LL, 87967825456500717LL,
+      59437719903041025LL, 37539612570341700LL, 22138745874816900LL,
+      12176310231149295LL, 6236646703759395LL, 2969831763694950LL,
+      1312251244423350LL, 536830054536825LL, 202802465047245LL,
+      70539987842520LL, 22512762077400LL, 6566222272575LL, 1742058970275LL,
+      418094152866LL, 90177170226LL, 17341763505LL, 2944827765LL, 436270780LL,
+      55525372LL, 5949147LL, 521855LL, 35990LL, 1830LL, 61LL, 1LL, 0LL, 0LL },
+    { 1LL, 62LL, 1891LL, 37820LL, 557845LL, 6471002LL, 61474519LL,
+      491796152LL, 3381098545LL, 20286591270LL, 107518933731LL,
+      508271323092LL, 2160153123141LL, 8308281242850LL, 29078984349975LL,
+      93052749919920LL, 273342452889765LL, 739632519584070LL,
+      1849081298960175LL, 4282083008118300LL, 9206478467454345LL,
+      18412956934908690LL, 34315056105966195LL, 59678358445158600LL,
+      96977332473382725LL, 147405545359541742LL, 209769429934732479LL,
+      279692573246309972LL, 349615716557887465LL, 409894288378212890LL,
+      450883717216034179LL, 465428353255261088LL, 450883717216034179LL,
+      409894288378212890LL, 349615716557887465LL, 279692573246309972LL,
+      209769429934732479LL, 147405545359541742LL, 96977332473382725LL,
+      59678358445158600LL, 34315056105966195LL, 18412956934908690LL,
+      9206478467454345LL, 4282083008118300LL, 1849081298960175LL,
+      739632519584070LL, 273342452889765LL, 93052749919920LL,
+      29078984349975LL, 8308281242850LL, 2160153123141LL, 508271323092LL,
+      107518933731LL, 20286591270LL, 3381098545LL, 491796152LL, 61474519LL,
+      6471002LL, 557845LL, 37820LL, 1891LL, 62LL, 1LL, 0LL },
+    { 1LL, 63LL, 1953LL, 39711LL, 595665LL, 7028847LL, 67945521LL,
+      553270671LL, 3872894697LL, 23667689815LL, 127805525001LL,
+      615790256823LL, 2668424446233LL, 10468434365991LL, 37387265592825LL,
+      122131734269895LL, 366395202809685LL, 1012974972473835LL,
+      2588713818544245LL, 6131164307078475LL, 13488561475572645LL,
+      27619435402363035LL, 52728013040874885LL, 93993414551124795LL,
+      156655690918541325LL, 244382877832924467LL, 357174975294274221LL,
+      489462003181042451LL, 629308289804197437LL, 759510004936100355LL,
+      860778005594247069LL, 916312070471295267LL, 916312070471295267LL,
+      860778005594247069LL, 759510004936100355LL, 629308289804197437LL,
+      489462003181042451LL, 357174975294274221LL, 244382877832924467LL,
+      156655690918541325LL, 93993414551124795LL, 52728013040874885LL,
+      27619435402363035LL, 13488561475572645LL, 6131164307078475LL,
+      2588713818544245LL, 1012974972473835LL, 366395202809685LL,
+      122131734269895LL, 37387265592825LL, 10468434365991LL, 2668424446233LL,
+      615790256823LL, 127805525001LL, 23667689815LL, 3872894697LL,
+      553270671LL, 67945521LL, 7028847LL, 595665LL, 39711LL, 1953LL, 63LL, 1LL }
+};
@@ -0,0 +1,80 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * PCG64 (XSL-RR 128/64) by Melissa O'Neill. <http://www.pcg-random.org/>
+ * A 128-bit LCG with a permuted output. Each increment gives a distinct
+ * stream, and jumping any distance is a few dozen 128-bit multiplies.
+ * Needs compiler support for 128-bit integers.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include "ojcardlib.h"
+
+#ifdef OJ_HAVE_INT128
+
+// State is kept as es.pcg[] = { state lo, state hi, increment lo, hi }.
+#define _PCG_MULT (((oj_uint128)0x2360ED051FC65DA4ull << 64) | \
+    0x4385DF649FCCF645ull)
+
+static oj_uint128 _get(const uint64_t *p) {
+    return ((oj_uint128)p[1] << 64) | p[0];
+}
+
+static void _put(uint64_t *p, oj_uint128 v) {
+    p[0] = (uint64_t)v;
+    p[1] = (uint64_t)(v >> 64);
+}
+
+// Key from 256 bits of seed: initial state, then stream selector, each
+// 128 bits low word first, as pcg64_srandom_r() takes them.
+void _ojr_pcg64_key(ojr_state *s, const uint32_t *e) {
+    oj_uint128 st = 0, seq = 0, inc;
+
+    for (int i = 3; i >= 0; --i) {
+        st = (st << 32) | e[i];
+        seq = (seq << 32) | e[i + 4];
+    }
+    inc = (seq << 1) | 1;
+    st = (inc + st) * _PCG_MULT + inc;
+    _put(s->es.pcg, st);
+    _put(s->es.pcg + 2, inc);
+}
+
+void _ojr_pcg64_reload(ojr_state *s) {
+    oj_uint128 st = _get(s->es.pcg), inc = _get(s->es.pcg + 2);
+    uint64_t x;
+    int r;
+
+    for (int i = 0; i < OJR_RING_WORDS; ++i) {
+        st = st * _PCG_MULT + inc;
+        x = (uint64_t)(st >> 64) ^ (uint64_t)st;
+        r = (int)(st >> 122);
+        s->ring.u64[i] = (x >> r) | (x << ((-r) & 63));
+    }
+    _put(s->es.pcg, st);
+}
+
+// Advance the LCG by composing its map with itself (Brown, 1994).
+void _ojr_pcg64_jump(ojr_state *s, uint64_t lo, uint64_t hi) {
+    oj_uint128 d = ((oj_uint128)hi << 64) | lo;
+    oj_uint128 am = 1, ap = 0, cm = _PCG_MULT, cp = _get(s->es.pcg + 2);
+
+    while (d) {
+        if (d & 1) {
+            am *= cm;
+            ap = ap * cm + cp;
+        }
+        cp = (cm + 1) * cp;
+        cm *= cm;
+        d >>= 1;
+    }
+    _put(s->es.pcg, am * _get(s->es.pcg) + ap);
+}
+
+#endif /* OJ_HAVE_INT128 */
@@ -0,0 +1,258 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Ranking orderings of card lists, so that a whole deck order can be
+ * stored as one number. The rank of an ordering is its index in
+ * lexicographic order of the cards (by value) via the Lehmer code: digit i
+ * is how many of the cards after position i are lower than the card at i.
+ * With the cards held in a bit mask, each digit is one popcount, and the
+ * digits are combined Horner-style as a mixed-radix number.
+ *
+ * 52! needs 226 bits, so ranks are 256-bit numbers of four 64-bit limbs,
+ * least significant first. Lists of up to 34 cards fit in 128 bits, which
+ * is faster where the compiler has them.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "ojcardlib.h"
+#include "bitops.h"
+
+// x = x * m + a, for m and a under 2^32. Returns nonzero on overflow.
+static int _u256_muladd(oj_uint256 *x, uint32_t m, uint32_t a) {
+    uint64_t lo, hi, carry = a;
+
+    for (int i = 0; i < 4; ++i) {
+        lo = (x->w[i] & 0xFFFFFFFFull) * m + carry;
+        hi = (x->w[i] >> 32) * m + (lo >> 32);
+        x->w[i] = (lo & 0xFFFFFFFFull) | (hi << 32);
+        carry = hi >> 32;
+    }
+    return 0 != carry;
+}
+
+// x = x / d, returning the remainder.
+static uint32_t _u256_divmod(oj_uint256 *x, uint32_t d) {
+    uint64_t t, q, r = 0;
+
+    for (int i = 3; i >= 0; --i) {
+        t = (r << 32) | (x->w[i] >> 32);
+        q = t / d;
+        r = t % d;
+        t = (r << 32) | (x->w[i] & 0xFFFFFFFFull);
+        x->w[i] = (q << 32) | (t / d);
+        r = t % d;
+    }
+    return (uint32_t)r;
+}
+
+static int _u256_iszero(const oj_uint256 *x) {
+    return 0 == (x->w[0] | x->w[1] | x->w[2] | x->w[3]);
+}
+
+// Bit number of the <n>th lowest set bit of <m> (counting from 0).
+static inline int _select(uint64_t m, int n) {
+    int b, c;
+
+    for (b = 0; b < 64; b += 8) {
+        c = POPCOUNT64((m >> b) & 0xFF);
+        if (n < c) break;
+        n -= c;
+    }
+    m >>= b;
+    while (n--) m &= m - 1;
+    return b + CTZ64(m);
+}
+
+// Mask of the cards in <p>, or 0 if any repeat.
+static uint64_t _card_mask(oj_cardlist *p) {
+    uint64_t b, m = 0ull;
+
+    for (int i = 0; i < p->length; ++i) {
+        assert(p->cards[i] > 0 && p->cards[i] <= 54);
+        b = 1ull << p->cards[i];
+        if (m & b) return 0ull;
+        m |= b;
+    }
+    return m;
+}
+
+// Rank of the ordering of the cards in <p>. Returns OJE_DUPLICATE if a
+// card repeats.
+int ojl_perm_rank(oj_cardlist *p, oj_uint256 *rank) {
+    uint64_t b, m = 0ull;
+    int n = p->length;
+    assert(0 != p && 0 != rank);
+
+    if (n > 0 && 0 == (m = _card_mask(p))) return OJE_DUPLICATE;
+    memset(rank, 0, sizeof(oj_uint256));
+
+    for (int i = 0; i < n; ++i) {
+        b = 1ull << p->cards[i];
+        m ^= b;
+        _u256_muladd(rank, n - i, POPCOUNT64(m & (b - 1)));
+    }
+    return 0;
+}
+
+// Put the cards of <p> into the order with the given rank. Returns
+// OJE_BADINDEX if the rank is n! or more.
+int ojl_perm_unrank(oj_cardlist *p, const oj_uint256 *rank) {
+    int i, c, n = p->length, d[56];
+    uint64_t m = 0ull;
+    oj_uint256 r = *rank;
+    assert(0 != p && 0 != rank);
+
+    if (p->pflags & OJF_RDONLY) return OJE_RDONLY;
+    if (n > 0 && 0 == (m = _card_mask(p))) return OJE_DUPLICATE;
+
+    for (i = n - 1; i >= 0; --i) d[i] = _u256_divmod(&r, n - i);
+    if (! _u256_iszero(&r)) return OJE_BADINDEX;
+
+    for (i = 0; i < n; ++i) {
+        c = _select(m, d[i]);
+        m &= ~(1ull << c);
+        p->cards[i] = c;
+    }
+    p->eflags = 0;
+    return 0;
+}
+
+#ifdef OJ_HAVE_INT128
+
+// Same as above for lists of up to 34 cards, whose ranks fit in 128 bits.
+// Returns OJE_FULL for longer ones.
+int ojl_perm_rank128(oj_cardlist *p, oj_uint128 *rank) {
+    uint64_t b, m = 0ull;
+    oj_uint128 r = 0;
+    int n = p->length;
+    assert(0 != p && 0 != rank);
+
+    if (n > 34) return OJE_FULL;
+    if (n > 0 && 0 == (m = _card_mask(p))) return OJE_DUPLICATE;
+
+    for (int i = 0; i < n; ++i) {
+        b = 1ull << p->cards[i];
+        m ^= b;
+        r = r * (n - i) + POPCOUNT64(m & (b - 1));
+    }
+    *rank = r;
+    return 0;
+}
+
+int ojl_perm_unrank128(oj_cardlist *p, oj_uint128 rank) {
+    int i, c, n = p->length, d[56];
+    uint64_t m = 0ull;
+    assert(0 != p);
+
+    if (p->pflags & OJF_RDONLY) return OJE_RDONLY;
+    if (n > 34) return OJE_FULL;
+    if (n > 0 && 0 == (m = _card_mask(p))) return OJE_DUPLICATE;
+
+    for (i = n - 1; i >= 0; --i) {
+        d[i] = (int)(rank % (unsigned)(n - i));
+        rank /= (unsigned)(n - i);
+    }
+    if (0 != rank) return OJE_BADINDEX;
+
+    for (i = 0; i < n; ++i) {
+        c = _select(m, d[i]);
+        m &= ~(1ull << c);
+        p->cards[i] = c;
+    }
+    p->eflags = 0;
+    return 0;
+}
+
+#endif /* OJ_HAVE_INT128 */
+
+/* Ordered hands drawn from a deck: digit i is how many of the deck cards
+ * not yet drawn come before hand card i in deck order, with radix n - i.
+ * There are n! / (n-k)! of them.
+ */
+int ojl_kperm_rank(oj_cardlist *deck, oj_cardlist *hand, oj_uint256 *rank) {
+    int i, x, inv[55];
+    uint64_t b, avail;
+    assert(0 != deck && 0 != hand && 0 != rank);
+    assert(deck->length <= 54);
+
+    for (i = 0; i < 55; ++i) inv[i] = -1;
+    for (i = 0; i < deck->length; ++i) inv[deck->cards[i]] = i;
+    avail = (1ull << deck->length) - 1;
+    memset(rank, 0, sizeof(oj_uint256));
+
+    for (i = 0; i < hand->length; ++i) {
+        if ((x = inv[hand->cards[i]]) < 0) return OJE_NOTFOUND;
+        b = 1ull << x;
+        if (! (avail & b)) return OJE_DUPLICATE;
+        avail ^= b;
+        _u256_muladd(rank, deck->length - i, POPCOUNT64(avail & (b - 1)));
+    }
+    return 0;
+}
+
+// Put the ordered <k>-card hand with the given rank into <hand>.
+int ojl_kperm_unrank(oj_cardlist *deck, int k, const oj_uint256 *rank,
+    oj_cardlist *hand) {
+    int i, x, n = deck->length, d[56];
+    uint64_t avail;
+    oj_uint256 r = *rank;
+    assert(0 != deck && 0 != hand && 0 != rank);
+    assert(n <= 54 && k >= 0 && k <= n);
+
+    if (hand->pflags & OJF_RDONLY) return OJE_RDONLY;
+    if (hand->allocation < k) return OJE_FULL;
+
+    for (i = k - 1; i >= 0; --i) d[i] = _u256_divmod(&r, n - i);
+    if (! _u256_iszero(&r)) return OJE_BADINDEX;
+
+    avail = (1ull << n) - 1;
+    for (i = 0; i < k; ++i) {
+        x = _select(avail, d[i]);
+        avail &= ~(1ull << x);
+        hand->cards[i] = deck->cards[x];
+    }
+    hand->length = k;
+    hand->eflags = 0;
+    return 0;
+}
+
+/* A shuffled 52-card deck in 29 bytes: its rank, least significant byte
+ * first. The list must hold each standard card exactly once.
+ */
+int ojl_pack(oj_cardlist *p, unsigned char *out) {
+    oj_uint256 r;
+    assert(0 != p && 0 != out);
+
+    if (52 != p->length || 0x1FFFFFFFFFFFFEull != _card_mask(p)) {
+        return OJE_BADINDEX;
+    }
+    ojl_perm_rank(p, &r);
+    for (int i = 0; i < OJL_PACKED_SIZE; ++i) {
+        out[i] = (unsigned char)(r.w[i >> 3] >> (8 * (i & 7)));
+    }
+    return 0;
+}
+
+int ojl_unpack(oj_cardlist *p, const unsigned char *in) {
+    oj_uint256 r;
+    assert(0 != p && 0 != in);
+
+    if (p->pflags & OJF_RDONLY) return OJE_RDONLY;
+    if (p->allocation < 52) return OJE_FULL;
+
+    memset(&r, 0, sizeof(r));
+    for (int i = 0; i < OJL_PACKED_SIZE; ++i) {
+        r.w[i >> 3] |= (uint64_t)in[i] << (8 * (i & 7));
+    }
+    for (int i = 0; i < 52; ++i) p->cards[i] = i + 1;
+    p->length = 52;
+    return ojl_perm_unrank(p, &r);
+}
@@ -0,0 +1,85 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Philox4x32-10 counter-based generator (Salmon et al., "Parallel Random
+ * Numbers: As Easy as 1, 2, 3", SC11). Output is a keyed bijection of a
+ * 128-bit counter, so block i of a stream can be had without computing
+ * blocks 0..i-1. We use it where something must be random-access, such as
+ * dealing deck number i of a seeded session directly.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+
+#include "ojcardlib.h"
+
+#define _PHILOX_M0 0xD2511F53u
+#define _PHILOX_M1 0xCD9E8D57u
+#define _PHILOX_W0 0x9E3779B9u
+#define _PHILOX_W1 0xBB67AE85u
+
+// Encrypt counter <ctr> with key <key> into <out>.
+void ojr_philox(const uint32_t *ctr, const uint32_t *key, uint32_t *out) {
+    uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint32_t k0 = key[0], k1 = key[1];
+    uint64_t p0, p1;
+
+    for (int i = 0; i < 10; ++i) {
+        p0 = (uint64_t)_PHILOX_M0 * c0;
+        p1 = (uint64_t)_PHILOX_M1 * c2;
+        c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        c1 = (uint32_t)p1;
+        c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c3 = (uint32_t)p0;
+        k0 += _PHILOX_W0;
+        k1 += _PHILOX_W1;
+    }
+    out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+/* As a generator engine: es.philox[] holds a 128-bit counter, low word
+ * first, then the key. The ring is the encryption of successive counts.
+ */
+void _ojr_philox_key(ojr_state *s, const uint32_t *e) {
+    uint32_t *p = s->es.philox;
+
+    p[0] = p[1] = p[2] = p[3] = 0;
+    p[4] = e[0];
+    p[5] = e[1];
+}
+
+static void _count(uint32_t *ctr, uint64_t lo, uint64_t hi) {
+    uint32_t d[4] = { (uint32_t)lo, (uint32_t)(lo >> 32),
+        (uint32_t)hi, (uint32_t)(hi >> 32) };
+    uint64_t t, c = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        t = (uint64_t)ctr[i] + d[i] + c;
+        ctr[i] = (uint32_t)t;
+        c = t >> 32;
+    }
+}
+
+void _ojr_philox_reload(ojr_state *s) {
+    uint32_t *p = s->es.philox;
+
+    for (int i = 0; i < 2 * OJR_RING_WORDS; i += 4) {
+        ojr_philox(p, p + 4, s->ring.u32 + i);
+        _count(p, 1, 0);
+    }
+}
+
+// Jump by whole blocks: the distance in 64-bit words, rounded up to even.
+void _ojr_philox_jump(ojr_state *s, uint64_t lo, uint64_t hi) {
+    uint64_t odd = lo & 1;
+
+    lo = (lo >> 1) | (hi << 63);
+    hi >>= 1;
+    _count(s->es.philox, lo, hi);
+    if (odd) _count(s->es.philox, 1, 0);
+}
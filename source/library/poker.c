@@ -15,14 +15,10 @@
 #include "ojcardlib.h"
 #include "ldctables.h"
 
-// Evaluate five-card poker hand.
-int ojp_eval5(oj_cardlist *p) {
-    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
-    assert(5 == p->length);
-
+// Evaluate five-card poker hand with the LDC tables.
+int _ojp_ldc5(oj_card *h) {
     return ldc4[ ldc3[ ldc2[ ldc1[
-        52 * (p->cards[0] - 1) + p->cards[1] ]
-           + p->cards[2] ] + p->cards[3] ] + p->cards[4] ];
+        52 * (h[0] - 1) + h[1] ] + h[2] ] + h[3] ] + h[4] ];
 }
 
 // On my machine, branchless MINs are actually a bit slower
@@ -31,8 +27,7 @@ int ojp_eval5(oj_cardlist *p) {
 
 // 7 cards is common enough to deserve special case code.
 // Unlike best5(), this won't return the actual hand, but it's faster.
-int ojp_eval7(oj_cardlist *p) {
-    oj_card *h = p->cards;
+int _ojp_ldc7(oj_card *h) {
     int b0 = 52 * (h[0] - 1);
     int b1 = ldc1[ b0 + h[1] ];
     int b2 = ldc2[ b1 + h[2] ];
@@ -132,6 +127,142 @@ int ojp_eval7(oj_cardlist *p) {
     return best;
 }
 
+static int _ldc_eval5(oj_cardlist *p) {
+    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
+    assert(5 == p->length);
+    return _ojp_ldc5(p->cards);
+}
+
+static int _ldc_eval7(oj_cardlist *p) {
+    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
+    assert(7 == p->length);
+    return _ojp_ldc7(p->cards);
+}
+
+static int _ldc_eval5_many(oj_card *h, int count, int *vals) {
+    for (int i = 0; i < count; ++i, h += 5) vals[i] = _ojp_ldc5(h);
+    return count;
+}
+
+static int _ldc_eval7_many(oj_card *h, int count, int *vals) {
+    for (int i = 0; i < count; ++i, h += 7) vals[i] = _ojp_ldc7(h);
+    return count;
+}
+
+static int _ldc_prepare(void) { return 0; }
+
+/* Evaluator engines. ojp_eval5() and ojp_eval7() call through function
+ * pointers that ojp_set_engine() sets, so evaluators can be compared or
+ * swapped at runtime. Every engine provides single-hand functions taking a
+ * cardlist and batch functions taking a flat buffer of hands with a stride
+ * of 5 or 7 cards. Engines that need tables build them in prepare().
+ */
+struct _ojp_engine {
+    const char *name, *description;
+    const long *tablebytes;
+    int (*prepare)(void);
+    int (*eval5)(oj_cardlist *);
+    int (*eval7)(oj_cardlist *);
+    int (*eval5_many)(oj_card *, int, int *);
+    int (*eval7_many)(oj_card *, int, int *);
+};
+
+extern int _ojp_split_prepare(void);
+extern int _ojp_split_eval5_many(oj_card *, int, int *);
+extern int _ojp_split_eval7_many(oj_card *, int, int *);
+extern int _ojp_prime_prepare(void);
+extern int _ojp_prime_eval5(oj_cardlist *);
+extern int _ojp_prime_eval7(oj_cardlist *);
+extern int _ojp_prime_eval5_many(oj_card *, int, int *);
+extern int _ojp_prime_eval7_many(oj_card *, int, int *);
+extern int _ojp_table7_prepare(void);
+extern int _ojp_table7_eval5(oj_cardlist *);
+extern int _ojp_table7_eval7(oj_cardlist *);
+extern int _ojp_table7_eval5_many(oj_card *, int, int *);
+extern int _ojp_table7_eval7_many(oj_card *, int, int *);
+extern const long _ojp_split_tablebytes, _ojp_prime_tablebytes,
+    _ojp_table7_tablebytes;
+static const long _ldc_tablebytes =
+    sizeof(ldc1) + sizeof(ldc2) + sizeof(ldc3) + sizeof(ldc4);
+
+static struct _ojp_engine _ojp_engines[] = {
+    { "ldc", "LDC state-machine tables", &_ldc_tablebytes, _ldc_prepare,
+        _ldc_eval5, _ldc_eval7, _ldc_eval5_many, _ldc_eval7_many },
+    { "split", "Rank-multiset tables for non-flush hands, LDC for flushes",
+        &_ojp_split_tablebytes, _ojp_split_prepare, ojp_eval5_split,
+        ojp_eval7_split, _ojp_split_eval5_many, _ojp_split_eval7_many },
+    { "prime", "Cactus Kev prime products with small tables",
+        &_ojp_prime_tablebytes, _ojp_prime_prepare, _ojp_prime_eval5,
+        _ojp_prime_eval7, _ojp_prime_eval5_many, _ojp_prime_eval7_many },
+    { "table7", "Direct 7-card table by colex rank, mapped from file",
+        &_ojp_table7_tablebytes, _ojp_table7_prepare, _ojp_table7_eval5,
+        _ojp_table7_eval7, _ojp_table7_eval5_many, _ojp_table7_eval7_many },
+};
+#define OJP_NENGINES ((int)(sizeof(_ojp_engines) / sizeof(_ojp_engines[0])))
+
+static int _ojp_current = OJP_ENGINE_LDC;
+static int (*_ojp_eval5_fn)(oj_cardlist *) = _ldc_eval5;
+static int (*_ojp_eval7_fn)(oj_cardlist *) = _ldc_eval7;
+static int (*_ojp_eval5_many_fn)(oj_card *, int, int *) = _ldc_eval5_many;
+static int (*_ojp_eval7_many_fn)(oj_card *, int, int *) = _ldc_eval7_many;
+
+// Select the evaluator used by ojp_eval5() and friends, building any
+// tables it needs. Returns 0 or negative error code.
+int ojp_set_engine(int id) {
+    struct _ojp_engine *ep;
+    int r;
+
+    if (id < 0 || id >= OJP_NENGINES) return OJE_BADINDEX;
+    ep = &_ojp_engines[id];
+    if (0 != (r = ep->prepare())) return r;
+
+    _ojp_eval5_fn = ep->eval5;
+    _ojp_eval7_fn = ep->eval7;
+    _ojp_eval5_many_fn = ep->eval5_many;
+    _ojp_eval7_many_fn = ep->eval7_many;
+    _ojp_current = id;
+    return 0;
+}
+
+int ojp_get_engine(void) { return _ojp_current; }
+
+int ojp_engine_count(void) { return OJP_NENGINES; }
+
+// Fill in information about the given engine.
+int ojp_engine_info(int id, oj_poker_engine_info *ip) {
+    struct _ojp_engine *ep;
+    assert(0 != ip);
+
+    if (id < 0 || id >= OJP_NENGINES) return OJE_BADINDEX;
+    ep = &_ojp_engines[id];
+
+    ip->_johnnymoss = 0x10ACE0FF;
+    ip->id = id;
+    ip->current = (id == _ojp_current);
+    ip->name = ep->name;
+    ip->description = ep->description;
+    ip->tablebytes = *ep->tablebytes;
+    return 0;
+}
+
+// Evaluate five-card poker hand.
+int ojp_eval5(oj_cardlist *p) { return _ojp_eval5_fn(p); }
+
+// Evaluate seven-card poker hand.
+int ojp_eval7(oj_cardlist *p) { return _ojp_eval7_fn(p); }
+
+// Evaluate <count> hands packed into a flat buffer, 5 or 7 cards each,
+// putting the values into <vals>. Returns the number evaluated.
+int ojp_eval5_many(oj_card *hands, int count, int *vals) {
+    assert(0 != hands && 0 != vals && count >= 0);
+    return _ojp_eval5_many_fn(hands, count, vals);
+}
+
+int ojp_eval7_many(oj_card *hands, int count, int *vals) {
+    assert(0 != hands && 0 != vals && count >= 0);
+    return _ojp_eval7_many_fn(hands, count, vals);
+}
+
 static oj_combiner _cmb;
 static oj_cardlist _hand;
 static oj_card _hbuf[8];
@@ -333,3 +464,157 @@ char *ojp_hand_description(oj_poker_hand_info *pi, char *buf, int size) {
     }
     return buf;
 }
+
+// Hand equivalence classes. Every poker hand of five or more cards has one
+// of OJP_NCLASSES distinct values, so aggregate questions like value
+// histograms and pay table returns need only visit each class once. Counts
+// are built from the 6175 (5 cards), 18395 (6) or 49205 (7) possible rank
+// multisets rather than by enumerating every hand: for each multiset we
+// count the suit assignments that make a flush separately from those that
+// don't, which is simple because no more than one suit can have five or
+// more cards when there are seven or fewer total.
+
+static oj_card _eqc_reps[OJP_NCLASSES + 1][5];
+static int64_t _eqc_counts[3][OJP_NCLASSES + 1];
+static int _eqc_built[3];
+
+static const int _choose4[] = { 1, 4, 6, 4, 1 };
+static const int _choose3[] = { 1, 3, 3, 1, 0 };
+
+// Best value of the first <n> cards of <h>, 5 <= n <= 7. Also used to
+// build the tables for the other evaluators.
+int _ojp_best_value(oj_card *h, int n) {
+    int v, best = 9999;
+    oj_card b[5];
+
+    if (5 == n) return _ojp_ldc5(h);
+    if (7 == n) return _ojp_ldc7(h);
+
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0, o = 0; j < 6; ++j) if (j != i) b[o++] = h[j];
+        v = _ojp_ldc5(b);
+        best = MIN(best, v);
+    }
+    return best;
+}
+
+// Record the hand in all of the classes reachable from the given rank
+// multiset with the number of ways each can be made.
+static void _eqc_leaf(int n, int *rc) {
+    int t = 0, nd = 0, d[7], v, vnf, vf;
+    int64_t ways = 1, fways = 0, w;
+    int64_t *counts = _eqc_counts[n - 5];
+    oj_card h[7], f[7];
+
+    // Spread suits so that no more than two cards share one.
+    for (int r = 0; r < 13; ++r) {
+        ways *= _choose4[rc[r]];
+        if (rc[r]) d[nd++] = r;
+        for (int j = 0; j < rc[r]; ++j, ++t) h[t] = OJ_CARD(r, t & 3);
+    }
+    vnf = _ojp_best_value(h, n);
+
+    // Flushes: every subset of at least five of the distinct ranks can be
+    // the set of cards in one suit.
+    for (int s = 0; nd >= 5 && s < (1 << nd); ++s) {
+        int nf = 0;
+        w = 4;
+        for (int i = 0; i < nd; ++i) {
+            if (s & (1 << i)) {
+                w *= _choose3[rc[d[i]] - 1];
+                f[nf++] = OJ_CARD(d[i], OJS_CLUB);
+            } else {
+                w *= _choose3[rc[d[i]]];
+            }
+        }
+        if (nf < 5 || 0 == w) continue;
+
+        vf = _ojp_best_value(f, nf);
+        v = MIN(vf, vnf);
+        counts[v] += w;
+        fways += w;
+        if (5 == n && 0 == _eqc_reps[v][0]) {
+            memmove(_eqc_reps[v], f, 5 * sizeof(oj_card));
+        }
+    }
+    counts[vnf] += ways - fways;
+    if (5 == n && ways > fways && 0 == _eqc_reps[vnf][0]) {
+        memmove(_eqc_reps[vnf], h, 5 * sizeof(oj_card));
+    }
+}
+
+static void _eqc_walk(int n, int *rc, int r, int left) {
+    if (13 == r) {
+        if (0 == left) _eqc_leaf(n, rc);
+        return;
+    }
+    for (int c = 0; c <= 4 && c <= left; ++c) {
+        rc[r] = c;
+        _eqc_walk(n, rc, r + 1, left - c);
+    }
+    rc[r] = 0;
+}
+
+static void _eqc_build(int n) {
+    int rc[13];
+    assert(n >= 5 && n <= 7);
+
+    if (_eqc_built[n - 5]) return;
+    if (5 != n) _eqc_build(5);
+
+    memset(rc, 0, sizeof(rc));
+    _eqc_walk(n, rc, 0, n);
+    _eqc_built[n - 5] = 1;
+}
+
+// Number of <ncards>-card hands whose best five cards have value <val>.
+int64_t ojp_eqclass_count(int val, int ncards) {
+    assert(val >= 1 && val <= OJP_NCLASSES);
+    assert(ncards >= 5 && ncards <= 7);
+
+    _eqc_build(ncards);
+    return _eqc_counts[ncards - 5][val];
+}
+
+// Initialize an iterator over the equivalence classes of <ncards>-card
+// hands. Each call to ojp_eqclass_next() puts a representative five-card
+// hand into <hand>, and the class value and count into the iterator.
+int ojp_eqclass_new(oj_poker_eqclass *ep, oj_cardlist *hand, int ncards) {
+    assert(0 != ep && 0 != hand && 0x10ACE0FF == hand->_johnnymoss);
+    assert(ncards >= 5 && ncards <= 7);
+
+    if (hand->pflags & OJF_RDONLY) return OJE_RDONLY;
+    if (hand->allocation < 5) return OJE_FULL;
+
+    _eqc_build(ncards);
+    ep->_johnnymoss = 0x10ACE0FF;
+    ep->ncards = ncards;
+    ep->val = 0;
+    ep->count = 0LL;
+    ep->hand = hand;
+    return 0;
+}
+
+// Advance to the next class with a nonzero count, in order of value.
+int ojp_eqclass_next(oj_poker_eqclass *ep) {
+    int64_t *counts;
+    oj_cardlist *p;
+    assert(0 != ep && 0x10ACE0FF == ep->_johnnymoss);
+
+    counts = _eqc_counts[ep->ncards - 5];
+    do {
+        if (ep->val >= OJP_NCLASSES) return 0;
+        ++ep->val;
+    } while (0 == counts[ep->val]);
+
+    ep->count = counts[ep->val];
+    p = ep->hand;
+    p->length = 5;
+    p->mask = 0LL;
+    for (int i = 0; i < 5; ++i) {
+        p->cards[i] = _eqc_reps[ep->val][i];
+        p->mask |= 1LL << p->cards[i];
+    }
+    p->eflags = 0;
+    return 1;
+}
@@ -0,0 +1,171 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Small-table evaluator after Kevin Suffecool's "Cactus Kev" method
+ * <http://suffe.cool/poker/evaluator.html>. Each card is coded with a
+ * rank bit, a suit bit, and a prime for its rank. Flushes and hands of
+ * five distinct ranks are looked up by the OR of their rank bits; all
+ * others by binary search on the product of their primes. About 60k of
+ * tables in all, for memory-tight builds. Tables are built from the LDC
+ * evaluator when the engine is first selected.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#include "ojcardlib.h"
+#include "bitops.h"
+
+extern int _ojp_best_value(oj_card *, int);
+
+#define NPRODUCTS 4888
+
+static const int _primes[] = {
+    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41
+};
+
+// Card codes: prime in bits 0-7, suit bit in 12-15, rank bit in 16-28.
+static uint32_t _codes[53];
+static uint16_t _flushes[8192], _unique5[8192];
+static uint32_t _products[NPRODUCTS];
+static uint16_t _pvalues[NPRODUCTS];
+static int _nproducts = 0, _ready = 0;
+
+const long _ojp_prime_tablebytes = sizeof(_codes) + sizeof(_flushes) +
+    sizeof(_unique5) + sizeof(_products) + sizeof(_pvalues);
+
+struct _pentry { uint32_t product; uint16_t value; };
+
+static int _pcompare(const void *a, const void *b) {
+    uint32_t pa = ((const struct _pentry *)a)->product;
+    uint32_t pb = ((const struct _pentry *)b)->product;
+    return (pa > pb) - (pa < pb);
+}
+
+static void _walk(struct _pentry *pe, int *rc, int r, int left) {
+    oj_card h[5], f[5];
+    int t = 0, bits = 0;
+    uint32_t product = 1;
+
+    if (13 == r) {
+        if (left) return;
+        for (int i = 0; i < 13; ++i) {
+            for (int j = 0; j < rc[i]; ++j, ++t) {
+                h[t] = OJ_CARD(i, t & 3);
+                f[t] = OJ_CARD(i, OJS_CLUB);
+                product *= _primes[i];
+            }
+            if (rc[i]) bits |= 1 << i;
+        }
+        if (5 == POPCOUNT64(bits)) {
+            _unique5[bits] = _ojp_best_value(h, 5);
+            _flushes[bits] = _ojp_best_value(f, 5);
+        } else {
+            assert(_nproducts < NPRODUCTS);
+            pe[_nproducts].product = product;
+            pe[_nproducts++].value = _ojp_best_value(h, 5);
+        }
+        return;
+    }
+    for (int c = 0; c <= 4 && c <= left; ++c) {
+        rc[r] = c;
+        _walk(pe, rc, r + 1, left - c);
+    }
+    rc[r] = 0;
+}
+
+int _ojp_prime_prepare(void) {
+    int rc[13];
+    struct _pentry *pe;
+
+    if (_ready) return 0;
+    for (int c = 1; c <= 52; ++c) {
+        _codes[c] = _primes[OJ_RANK(c)] | (0x1000 << OJ_SUIT(c)) |
+            (0x10000 << OJ_RANK(c));
+    }
+    pe = malloc(NPRODUCTS * sizeof(struct _pentry));
+    if (0 == pe) return OJE_FULL;
+
+    memset(rc, 0, sizeof(rc));
+    _nproducts = 0;
+    _walk(pe, rc, 0, 5);
+    assert(NPRODUCTS == _nproducts);
+
+    qsort(pe, _nproducts, sizeof(struct _pentry), _pcompare);
+    for (int i = 0; i < _nproducts; ++i) {
+        _products[i] = pe[i].product;
+        _pvalues[i] = pe[i].value;
+    }
+    free(pe);
+    _ready = 1;
+    return 0;
+}
+
+static int _prime5(oj_card *h) {
+    uint32_t c0 = _codes[h[0]], c1 = _codes[h[1]], c2 = _codes[h[2]],
+        c3 = _codes[h[3]], c4 = _codes[h[4]];
+    uint32_t q = (c0 | c1 | c2 | c3 | c4) >> 16, p;
+    int lo = 0, hi = NPRODUCTS - 1, mid;
+
+    if (c0 & c1 & c2 & c3 & c4 & 0xF000) return _flushes[q];
+    if (_unique5[q]) return _unique5[q];
+
+    p = (c0 & 0xFF) * (c1 & 0xFF) * (c2 & 0xFF) * (c3 & 0xFF) * (c4 & 0xFF);
+    while (lo < hi) {
+        mid = (lo + hi) >> 1;
+        if (_products[mid] < p) lo = mid + 1;
+        else hi = mid;
+    }
+    assert(_products[lo] == p);
+    return _pvalues[lo];
+}
+
+// Best of the 21 five-card subsets.
+static const int _perm7[21][5] = {
+    {0,1,2,3,4}, {0,1,2,3,5}, {0,1,2,3,6}, {0,1,2,4,5}, {0,1,2,4,6},
+    {0,1,2,5,6}, {0,1,3,4,5}, {0,1,3,4,6}, {0,1,3,5,6}, {0,1,4,5,6},
+    {0,2,3,4,5}, {0,2,3,4,6}, {0,2,3,5,6}, {0,2,4,5,6}, {0,3,4,5,6},
+    {1,2,3,4,5}, {1,2,3,4,6}, {1,2,3,5,6}, {1,2,4,5,6}, {1,3,4,5,6},
+    {2,3,4,5,6}
+};
+
+static int _prime7(oj_card *h) {
+    oj_card s[5];
+    int v, best = 9999;
+
+    for (int i = 0; i < 21; ++i) {
+        for (int j = 0; j < 5; ++j) s[j] = h[_perm7[i][j]];
+        v = _prime5(s);
+        if (v < best) best = v;
+    }
+    return best;
+}
+
+int _ojp_prime_eval5(oj_cardlist *p) {
+    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
+    assert(5 == p->length && _ready);
+    return _prime5(p->cards);
+}
+
+int _ojp_prime_eval7(oj_cardlist *p) {
+    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
+    assert(7 == p->length && _ready);
+    return _prime7(p->cards);
+}
+
+int _ojp_prime_eval5_many(oj_card *h, int count, int *vals) {
+    assert(_ready);
+    for (int i = 0; i < count; ++i, h += 5) vals[i] = _prime5(h);
+    return count;
+}
+
+int _ojp_prime_eval7_many(oj_card *h, int count, int *vals) {
+    assert(_ready);
+    for (int i = 0; i < count; ++i, h += 7) vals[i] = _prime7(h);
+    return count;
+}
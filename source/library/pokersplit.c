@@ -0,0 +1,254 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Flush-first split evaluator. If no suit has five or more cards, the
+ * value of a hand depends only on its multiset of ranks, so we look it up
+ * in a small table indexed by a perfect hash of the rank counts rather
+ * than walking the big LDC tables. The 5-card table is 12k and fits in L1;
+ * 7 cards need 96k. Hands that can make a flush take the full LDC path.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#include "ojcardlib.h"
+#include "bitops.h"
+
+extern int _ojp_best_value(oj_card *, int);
+extern int _ojp_ldc5(oj_card *);
+extern int _ojp_ldc7(oj_card *);
+
+// Bits of a card mask belonging to each suit.
+#define SUITBITS 0x2222222222222ull
+#define SUIT_MASK(s) (SUITBITS << (s))
+
+/* Perfect hash of rank counts. _qcount[r][k] is the number of ways to put
+ * <k> cards into ranks r..12 with at most 4 of each. The hash of a count
+ * vector is its index in lexicographic order among all vectors with the
+ * same total, which is the sum over ranks of _qoff[r][k][c], where <k> is
+ * the number of cards not yet accounted for by lower ranks.
+ */
+static int _qcount[14][8];
+static int _qoff[13][8][5];
+static int _qready = 0;
+
+static uint16_t _nf5[6175], _nf6[18395], _nf7[49205];
+static uint16_t *_nftables[] = { _nf5, _nf6, _nf7 };
+static int _nfbuilt[3];
+
+const long _ojp_split_tablebytes = sizeof(_nf5) + sizeof(_nf6) +
+    sizeof(_nf7) + sizeof(_qoff);
+
+// Best flush (or straight flush) value for each 13-bit set of ranks in one
+// suit with 5 to 7 bits set, for ojp_eval_mask().
+static uint16_t _flush13[8192];
+static int _flushbuilt = 0;
+
+static void _build_offsets(void) {
+    int r, k, c;
+
+    memset(_qcount, 0, sizeof(_qcount));
+    _qcount[13][0] = 1;
+    for (r = 12; r >= 0; --r) {
+        for (k = 0; k < 8; ++k) {
+            for (c = 0; c <= 4 && c <= k; ++c) {
+                _qcount[r][k] += _qcount[r + 1][k - c];
+            }
+        }
+    }
+    for (r = 0; r < 13; ++r) {
+        for (k = 0; k < 8; ++k) {
+            _qoff[r][k][0] = 0;
+            for (c = 1; c <= 4; ++c) {
+                _qoff[r][k][c] = _qoff[r][k][c - 1] +
+                    ((c - 1 <= k) ? _qcount[r + 1][k - (c - 1)] : 0);
+            }
+        }
+    }
+    _qready = 1;
+}
+
+static void _walk(int n, int *rc, int r, int left, int hash) {
+    oj_card h[7];
+    int t = 0;
+
+    if (13 == r) {
+        if (left) return;
+        for (int i = 0; i < 13; ++i) {
+            for (int j = 0; j < rc[i]; ++j, ++t) h[t] = OJ_CARD(i, t & 3);
+        }
+        _nftables[n - 5][hash] = _ojp_best_value(h, n);
+        return;
+    }
+    for (int c = 0; c <= 4 && c <= left; ++c) {
+        rc[r] = c;
+        _walk(n, rc, r + 1, left - c, hash + _qoff[r][left][c]);
+    }
+    rc[r] = 0;
+}
+
+// Fill the non-flush table for <n>-card hands.
+void _ojp_build_nftable(int n) {
+    int rc[13];
+    assert(n >= 5 && n <= 7);
+
+    if (_nfbuilt[n - 5]) return;
+    if (! _qready) _build_offsets();
+
+    memset(rc, 0, sizeof(rc));
+    _walk(n, rc, 0, n, 0);
+    _nfbuilt[n - 5] = 1;
+}
+
+// Value of a non-flush hand of <n> cards given its card mask.
+int _ojp_nf_value(uint64_t m, int n) {
+    int h = 0, k = n;
+
+    for (int r = 0; k && r < 13; ++r) {
+        int c = POPCOUNT64((m >> (4 * r + 1)) & 0xF);
+        h += _qoff[r][k][c];
+        k -= c;
+    }
+    return _nftables[n - 5][h];
+}
+
+// Return the card mask of the hand, building it if the list doesn't keep one.
+static uint64_t _hand_mask(oj_cardlist *p) {
+    uint64_t m = 0ull;
+
+    if (p->pflags & OJF_UNIQUE) return p->mask;
+    for (int i = 0; i < p->length; ++i) m |= 1ull << p->cards[i];
+    return m;
+}
+
+// A mask short of cards means duplicates, which the tables don't cover;
+// those go to LDC like flushes do.
+static int _split5(oj_card *h, uint64_t m) {
+    if (5 != POPCOUNT64(m)) return _ojp_ldc5(h);
+    if (5 == POPCOUNT64(m & SUIT_MASK(OJ_SUIT(h[0])))) return _ojp_ldc5(h);
+    return _ojp_nf_value(m, 5);
+}
+
+static int _split7(oj_card *h, uint64_t m) {
+    if (7 != POPCOUNT64(m)) return _ojp_ldc7(h);
+    if (POPCOUNT64(m & SUIT_MASK(0)) >= 5 ||
+        POPCOUNT64(m & SUIT_MASK(1)) >= 5 ||
+        POPCOUNT64(m & SUIT_MASK(2)) >= 5 ||
+        POPCOUNT64(m & SUIT_MASK(3)) >= 5) return _ojp_ldc7(h);
+    return _ojp_nf_value(m, 7);
+}
+
+int ojp_eval5_split(oj_cardlist *p) {
+    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
+    assert(5 == p->length);
+
+    if (! _nfbuilt[0]) _ojp_build_nftable(5);
+    return _split5(p->cards, _hand_mask(p));
+}
+
+int ojp_eval7_split(oj_cardlist *p) {
+    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
+    assert(7 == p->length);
+
+    if (! _nfbuilt[2]) _ojp_build_nftable(7);
+    return _split7(p->cards, _hand_mask(p));
+}
+
+// Engine interface (see poker.c)
+int _ojp_split_prepare(void) {
+    _ojp_build_nftable(5);
+    _ojp_build_nftable(7);
+    return 0;
+}
+
+int _ojp_split_eval5_many(oj_card *h, int count, int *vals) {
+    if (! _nfbuilt[0]) _ojp_build_nftable(5);
+
+    for (int i = 0; i < count; ++i, h += 5) {
+        uint64_t m = (1ull << h[0]) | (1ull << h[1]) | (1ull << h[2]) |
+            (1ull << h[3]) | (1ull << h[4]);
+        vals[i] = _split5(h, m);
+    }
+    return count;
+}
+
+int _ojp_split_eval7_many(oj_card *h, int count, int *vals) {
+    if (! _nfbuilt[2]) _ojp_build_nftable(7);
+
+    for (int i = 0; i < count; ++i, h += 7) {
+        uint64_t m = (1ull << h[0]) | (1ull << h[1]) | (1ull << h[2]) |
+            (1ull << h[3]) | (1ull << h[4]) | (1ull << h[5]) | (1ull << h[6]);
+        vals[i] = _split7(h, m);
+    }
+    return count;
+}
+
+static void _build_flush13(void) {
+    oj_card f[7];
+    int n;
+
+    for (int q = 0; q < 8192; ++q) {
+        n = POPCOUNT64(q);
+        if (n < 5 || n > 7) continue;
+
+        n = 0;
+        for (int r = 0; r < 13; ++r) {
+            if (q & (1 << r)) f[n++] = OJ_CARD(r, OJS_CLUB);
+        }
+        _flush13[q] = _ojp_best_value(f, n);
+    }
+    _flushbuilt = 1;
+}
+
+// Gather the ranks of suit <s> from a card mask into 13 contiguous bits.
+static int _suit_ranks(uint64_t m, int s) {
+    uint64_t x = (m >> (1 + s)) & 0x1111111111111ull;
+
+    x = (x | (x >> 3)) & 0x0303030303030303ull;
+    x = (x | (x >> 6)) & 0x000F000F000F000Full;
+    x = (x | (x >> 12)) & 0x000000FF000000FFull;
+    x = (x | (x >> 24)) & 0xFFFFull;
+    return (int)x;
+}
+
+static int _mask_value(uint64_t m) {
+    int n = POPCOUNT64(m);
+    assert(n >= 5 && n <= 7);
+
+    for (int s = 0; s < 4; ++s) {
+        if (POPCOUNT64(m & SUIT_MASK(s)) >= 5) {
+            return _flush13[_suit_ranks(m, s)];
+        }
+    }
+    return _ojp_nf_value(m, n);
+}
+
+static void _build_mask_tables(void) {
+    _ojp_build_nftable(5);
+    _ojp_build_nftable(6);
+    _ojp_build_nftable(7);
+    if (! _flushbuilt) _build_flush13();
+}
+
+/* Evaluate a hand of 5 to 7 cards given as a card mask (bit <c> set for
+ * card <c>, as in oj_cardlist.mask), without building a card array. With
+ * seven or fewer cards no hand can have both a flush and a full house or
+ * better, so a flush hand's value is just that of its best flush.
+ */
+int ojp_eval_mask(uint64_t m) {
+    if (! _flushbuilt) _build_mask_tables();
+    return _mask_value(m);
+}
+
+int ojp_eval_mask_many(uint64_t *masks, int count, int *vals) {
+    assert(0 != masks && 0 != vals && count >= 0);
+
+    if (! _flushbuilt) _build_mask_tables();
+    for (int i = 0; i < count; ++i) vals[i] = _mask_value(masks[i]);
+    return count;
+}
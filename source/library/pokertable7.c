@@ -0,0 +1,197 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Optional direct 7-card evaluator: the value of every 7-card hand, in
+ * colex order, in one 266 MB file. ojp_table7_build() writes the file once;
+ * ojp_table7_load() maps it read-only and shared, so every process using it
+ * shares one copy in the page cache. After that, ojp_eval7() with the
+ * table7 engine is one colex rank and one load.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
+#include "ojcardlib.h"
+#include "bitops.h"
+
+extern int _ojp_ldc5(oj_card *);
+extern int _ojp_ldc7(oj_card *);
+extern int _ojp_nf_value(uint64_t, int);
+extern void _ojp_build_nftable(int);
+
+// File is a 16-byte header followed by the table in native byte order.
+struct _t7header {
+    char magic[4];
+    uint16_t bom, version;
+    uint32_t count, reserved;
+};
+#define T7_HEADER { { 'O', 'J', 'P', '7' }, 0x0102, 1, \
+    (uint32_t)OJP_TABLE7_SIZE, 0 }
+
+static const uint16_t *_table7 = NULL;
+static void *_t7map = NULL;
+static size_t _t7size = 0;
+
+const long _ojp_table7_tablebytes = (long)(OJP_TABLE7_SIZE * 2);
+
+#define SUIT_MASK(s) (0x2222222222222ull << (s))
+#define BUFSIZE 65536
+
+static int _value7(oj_card *h, uint64_t m) {
+    if (POPCOUNT64(m & SUIT_MASK(0)) >= 5 ||
+        POPCOUNT64(m & SUIT_MASK(1)) >= 5 ||
+        POPCOUNT64(m & SUIT_MASK(2)) >= 5 ||
+        POPCOUNT64(m & SUIT_MASK(3)) >= 5) return _ojp_ldc7(h);
+    return _ojp_nf_value(m, 7);
+}
+
+// Write the table to the given file. This takes a while.
+int ojp_table7_build(const char *path) {
+    struct _t7header hd = T7_HEADER;
+    uint16_t *buf;
+    oj_card h[7];
+    uint64_t m[8];
+    int n = 0, ok = 1;
+    int64_t count = 0LL;
+    FILE *fp;
+    assert(0 != path);
+
+    _ojp_build_nftable(7);
+    if (0 == (buf = malloc(BUFSIZE * sizeof(uint16_t)))) return OJE_FULL;
+    if (0 == (fp = fopen(path, "wb"))) {
+        free(buf);
+        return OJE_NOTFOUND;
+    }
+    ok = (1 == fwrite(&hd, sizeof(hd), 1, fp));
+
+    // Nested so that the innermost card varies fastest: colex order.
+    m[7] = 0ull;
+    for (h[6] = 7; ok && h[6] <= 52; ++h[6]) {
+     m[6] = m[7] | (1ull << h[6]);
+     for (h[5] = 6; h[5] < h[6]; ++h[5]) {
+      m[5] = m[6] | (1ull << h[5]);
+      for (h[4] = 5; h[4] < h[5]; ++h[4]) {
+       m[4] = m[5] | (1ull << h[4]);
+       for (h[3] = 4; h[3] < h[4]; ++h[3]) {
+        m[3] = m[4] | (1ull << h[3]);
+        for (h[2] = 3; h[2] < h[3]; ++h[2]) {
+         m[2] = m[3] | (1ull << h[2]);
+         for (h[1] = 2; h[1] < h[2]; ++h[1]) {
+          m[1] = m[2] | (1ull << h[1]);
+          for (h[0] = 1; h[0] < h[1]; ++h[0]) {
+            m[0] = m[1] | (1ull << h[0]);
+            buf[n++] = _value7(h, m[0]);
+            if (BUFSIZE == n) {
+                ok = ok && (BUFSIZE == fwrite(buf, sizeof(uint16_t), n, fp));
+                count += n;
+                n = 0;
+            }
+          }
+         }
+        }
+       }
+      }
+     }
+    }
+    if (n) ok = ok && ((size_t)n == fwrite(buf, sizeof(uint16_t), n, fp));
+    count += n;
+    ok = (0 == fclose(fp)) && ok;
+    free(buf);
+
+    if (! ok) return OJE_FULL;
+    assert(OJP_TABLE7_SIZE == count);
+    return 0;
+}
+
+// Map the table file. Returns 0 or negative error code.
+int ojp_table7_load(const char *path) {
+#ifdef _WIN32
+    (void)path;
+    return OJE_NOTFOUND;
+#else
+    struct _t7header hd = T7_HEADER;
+    struct stat st;
+    void *mp;
+    int fd;
+    assert(0 != path);
+
+    if (NULL != _table7) ojp_table7_unload();
+
+    if (-1 == (fd = open(path, O_RDONLY))) return OJE_NOTFOUND;
+    if (0 != fstat(fd, &st) ||
+        (size_t)st.st_size != sizeof(hd) + (size_t)_ojp_table7_tablebytes) {
+        close(fd);
+        return OJE_BADINDEX;
+    }
+    mp = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == mp) return OJE_FULL;
+
+    if (0 != memcmp(mp, &hd, sizeof(hd))) {
+        munmap(mp, st.st_size);
+        return OJE_BADINDEX;
+    }
+    _t7map = mp;
+    _t7size = st.st_size;
+    _table7 = (const uint16_t *)((char *)mp + sizeof(hd));
+    return 0;
+#endif
+}
+
+// Release the mapping, falling back to the default engine if needed.
+int ojp_table7_unload(void) {
+    if (NULL == _table7) return 0;
+    if (OJP_ENGINE_TABLE7 == ojp_get_engine()) ojp_set_engine(OJP_ENGINE_LDC);
+#ifndef _WIN32
+    munmap(_t7map, _t7size);
+#endif
+    _table7 = NULL;
+    _t7map = NULL;
+    _t7size = 0;
+    return 0;
+}
+
+// Engine interface (see poker.c). Five-card hands use LDC.
+int _ojp_table7_prepare(void) {
+    return (NULL == _table7) ? OJE_NOTFOUND : 0;
+}
+
+int _ojp_table7_eval5(oj_cardlist *p) {
+    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
+    assert(5 == p->length);
+    return _ojp_ldc5(p->cards);
+}
+
+int _ojp_table7_eval7(oj_cardlist *p) {
+    assert(0 != p && 0x10ACE0FF == p->_johnnymoss);
+    assert(7 == p->length && NULL != _table7);
+    return _table7[ojc_colex_rank7(p->cards)];
+}
+
+int _ojp_table7_eval5_many(oj_card *h, int count, int *vals) {
+    for (int i = 0; i < count; ++i, h += 5) vals[i] = _ojp_ldc5(h);
+    return count;
+}
+
+int _ojp_table7_eval7_many(oj_card *h, int count, int *vals) {
+    assert(NULL != _table7);
+    for (int i = 0; i < count; ++i, h += 7) {
+        vals[i] = _table7[ojc_colex_rank7(h)];
+    }
+    return count;
+}
@@ -15,53 +15,150 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <time.h>
+#include <string.h>
 
 #ifdef _WIN32
 #include <windows.h>
 #include <wincrypt.h>
+#else
+#include <pthread.h>
 #endif
 
 #include "ojcardlib.h"
 
-// Seed variables
-static uint64_t x, y;
-static uint32_t z1, c1, z2, c2;
-static int _seeded = 0;
+// Generator constants
+#define _LCGA 1490024343005336237ull
+#define _LCGC 123456789ull
+#define _MWC1 4294584393ull
+#define _MWC2 4246477509ull
+
+/* All of the generator's state lives in an ojr_state, so each thread can
+ * have its own with no sharing. The plain functions use a library-wide
+ * default state, which is not safe to share between threads. It is seeded
+ * from system entropy the first time it is used, unless it was seeded
+ * explicitly before that, so that programs that never use it don't pay
+ * for it; see _dflt() below.
+ */
+static ojr_state _default = { ._johnnymoss = 0x10ACE0FF };
+static int _default_auto;
+static ojr_state *_dflt(void);
 
-// Ring buffer for random bits. We calculate a bufferfull of random bits
-// at a time, and fetch them from the buffer, refilling when needed.
-#define RB_SIZE 2048
-static uint16_t *rptr, ring[RB_SIZE / 2];
+ojr_state *ojr_default_state(void) { return _dflt(); }
 
-// Seed the PRNG. If we are passed 0, generate a good seed from system
-// entropy. Otherwise, give a reproducible sequence.
-int ojr_seed(int seed) {
-    uint32_t s[8];
+/* Engines. The ring buffer can be filled by any of several generators,
+ * chosen per state with ojr_set_engine_r(); everything that reads from
+ * the ring is the same for all of them. Every state also carries a JKISS
+ * generator, which is what a small integer seed sets directly; other
+ * engines are keyed with 256 bits taken from it, or straight from system
+ * entropy when seeding with 0. Jump distances are in 64-bit words.
+ */
+struct _ojr_engine {
+    const char *name, *description;
+    void (*key)(ojr_state *, const uint32_t *);
+    void (*reload)(ojr_state *);
+    void (*jump)(ojr_state *, uint64_t, uint64_t);
+};
+
+static void _key_jkiss(ojr_state *, const uint32_t *);
+static void _reload_jkiss(ojr_state *);
+static void _jump_jkiss(ojr_state *, uint64_t, uint64_t);
+static void _key_jkiss4(ojr_state *, const uint32_t *);
+static void _reload_jkiss4(ojr_state *);
+extern void _ojr_xoshiro_key(ojr_state *, const uint32_t *);
+extern void _ojr_xoshiro_reload(ojr_state *);
+extern void _ojr_xoshiro_jump(ojr_state *, uint64_t, uint64_t);
+extern void _ojr_chacha20_key(ojr_state *, const uint32_t *);
+extern void _ojr_chacha20_reload(ojr_state *);
+extern void _ojr_chacha20_jump(ojr_state *, uint64_t, uint64_t);
+extern void _ojr_philox_key(ojr_state *, const uint32_t *);
+extern void _ojr_philox_reload(ojr_state *);
+extern void _ojr_philox_jump(ojr_state *, uint64_t, uint64_t);
+#ifdef OJ_HAVE_INT128
+extern void _ojr_pcg64_key(ojr_state *, const uint32_t *);
+extern void _ojr_pcg64_reload(ojr_state *);
+extern void _ojr_pcg64_jump(ojr_state *, uint64_t, uint64_t);
+#else
+#define _ojr_pcg64_key 0
+#define _ojr_pcg64_reload 0
+#define _ojr_pcg64_jump 0
+#endif
+
+static const struct _ojr_engine _ojr_engines[] = {
+    { "jkiss", "JKISS: LCG, xorshift and two multiply-with-carry",
+        _key_jkiss, _reload_jkiss, _jump_jkiss },
+    { "jkiss4", "Four JKISS lanes in vector registers",
+        _key_jkiss4, _reload_jkiss4, _jump_jkiss },
+    { "xoshiro", "Xoshiro256**, fastest, for simulation",
+        _ojr_xoshiro_key, _ojr_xoshiro_reload, _ojr_xoshiro_jump },
+    { "pcg64", "PCG64 XSL-RR 128/64",
+        _ojr_pcg64_key, _ojr_pcg64_reload, _ojr_pcg64_jump },
+    { "chacha20", "ChaCha20 keystream, cryptographically strong",
+        _ojr_chacha20_key, _ojr_chacha20_reload, _ojr_chacha20_jump },
+    { "philox", "Philox4x32-10 counter mode",
+        _ojr_philox_key, _ojr_philox_reload, _ojr_philox_jump },
+};
+#define OJR_NENGINES ((int)(sizeof(_ojr_engines) / sizeof(_ojr_engines[0])))
+
+static void _init(ojr_state *s, int engine) {
+    memset(s, 0, sizeof(ojr_state));
+    s->_johnnymoss = 0x10ACE0FF;
+    s->engine = engine;
+}
+
+// Initialize a new generator state and seed it.
+int ojr_new(ojr_state *s, int seed) {
+    assert(0 != s);
+
+    _init(s, OJR_ENGINE_JKISS);
+    return ojr_seed_r(s, seed);
+}
+
+// Set the JKISS variables from 256 bits of seed.
+static void _jkiss_from(ojr_state *s, const uint32_t *e) {
+    s->x = ((uint64_t)e[1] << 32) | e[0];
+    s->y = ((uint64_t)e[3] << 32) | e[2];
+    if (0ull == s->y) s->y = 987654321987ull;
+
+    // Keep the carries below the multipliers so that the jumps below
+    // see the same sequence as stepping.
+    s->z1 = e[4];
+    s->c1 = e[5] | (1 << 28);
+    if (s->c1 >= _MWC1) s->c1 -= _MWC1;
+    s->z2 = e[6];
+    s->c2 = e[7] | (1 << 29);
+    if (s->c2 >= _MWC2) s->c2 -= _MWC2;
+}
+
+// Seed the JKISS variables. If we are passed 0, generate a good seed from
+// system entropy. Otherwise, give a reproducible sequence. Returns 1 if
+// <e> got 256 bits of entropy, 0 if not.
+static int _seed(ojr_state *s, int seed, uint32_t *e) {
     time_t t;
 #ifdef _WIN32
     HCRYPTPROV hCryptProv;
 #else
     int fn;
 #endif
+    assert(0 != s && 0x10ACE0FF == s->_johnnymoss);
 
     // Make sure we reload on first call
-    rptr = ring;
+    s->left = 0;
 
     // Start with some reasonable defaults
-    x = 123456789123ull;
-    y = 987654321987ull;
-    z1 = 43219876;
-    c1 = 6543217;
-    z2 = 21987643;
-    c2 = 1732654;
-    _seeded = 0;
+    s->x = 123456789123ull;
+    s->y = 987654321987ull;
+    s->z1 = 43219876;
+    s->c1 = 6543217;
+    s->z2 = 21987643;
+    s->c2 = 1732654;
+    s->seeded = 0;
 
     // If we were passed a nonzero seed, mix those bits in with the
     // defaults to get a repeatable sequence.
     if (0 != seed) {
-        x ^= (0x5A5A5A5A & seed);
-        y ^= (0xA5A5A5A5 & seed);
-        _seeded = 1;
+        s->x ^= (0x5A5A5A5A & seed);
+        s->y ^= (0xA5A5A5A5 & seed);
+        s->seeded = 1;
         return 0;
     }
     // Fetch seed from system entropy.
@@ -74,111 +171,847 @@ int ojr_seed(int seed) {
                 break;
             }
         }
-        if (CryptGenRandom(hCryptProv, 32, (BYTE *)s)) _seeded = 1;
+        if (CryptGenRandom(hCryptProv, 32, (BYTE *)e)) s->seeded = 1;
         CryptReleaseContext(hCryptProv, 0);
     } while (0);
 #else
     fn = open("/dev/urandom", O_RDONLY);
     if (-1 != fn) {
-        if (32 == read(fn, s, 32)) _seeded = 1;
+        if (32 == read(fn, e, 32)) s->seeded = 1;
         close(fn);
     }
 #endif
-    if (_seeded) {
-        x = *(uint64_t *)s;
-        y = *(uint64_t *)(s + 2);
-        if (0ull == y) y = 987654321987ull;
-
-        z1 = s[4];
-        c1 = s[5] | (1 << 28);
-        z2 = s[6];
-        c2 = s[7] | (1 << 29);
-        return 0;
+    if (s->seeded) {
+        _jkiss_from(s, e);
+        return 1;
     }
     // Fall back to using time()
     time(&t);
-    x ^= (0xA5A5A5A5 & t);
-    y ^= (0x5A5A5A5A & t);
-    _seeded = 1;
+    s->x ^= (0xA5A5A5A5 & t);
+    s->y ^= (0x5A5A5A5A & t);
+    s->seeded = 1;
+    return 0;
+}
+
+static inline uint64_t _jkiss_step(ojr_lane *l) {
+    uint64_t t;
+
+    l->x = _LCGA * l->x + _LCGC;
+
+    l->y ^= l->y << 21;
+    l->y ^= l->y >> 17;
+    l->y ^= l->y << 30;
+
+    t = _MWC1 * l->z1 + l->c1;
+    l->c1 = t >> 32;
+    l->z1 = t;
+
+    t = _MWC2 * l->z2 + l->c2;
+    l->c2 = t >> 32;
+    l->z2 = t;
+
+    return l->x + l->y + l->z1 + ((uint64_t)l->z2 << 32);
+}
+
+// 256 bits of key for other engines, from the JKISS variables.
+static void _jkiss_key(ojr_state *s, uint32_t *e) {
+    ojr_lane l = { s->x, s->y, s->z1, s->c1, s->z2, s->c2 };
+    uint64_t v;
+
+    for (int i = 0; i < 8; i += 2) {
+        v = _jkiss_step(&l);
+        e[i] = (uint32_t)v;
+        e[i + 1] = (uint32_t)(v >> 32);
+    }
+}
+
+static void _watch_forks(void);
+
+int ojr_seed_r(ojr_state *s, int seed) {
+    uint32_t e[8];
+
+    if (! _seed(s, seed, e)) _jkiss_key(s, e);
+    _ojr_engines[s->engine].key(s, e);
+
+    if (&_default == s) {
+        _watch_forks();
+        _default_auto = (0 == seed);
+    }
+    return 0;
+}
+
+// Reseed the default state, keeping whatever engine was selected for it.
+int ojr_seed(int seed) {
+    return ojr_seed_r(&_default, seed);
+}
+
+/* A forked child gets a copy of its parent's default state, and would
+ * deal the same cards as the parent and all of its siblings. So if the
+ * default state was seeded from entropy, the child reseeds it from fresh
+ * entropy right away, which also covers pointers to it the parent got
+ * from ojr_default_state(). One that was given a seed or a saved state
+ * keeps it, since then the same output is what was asked for. States of
+ * your own are yours to reseed.
+ */
+#ifndef _WIN32
+static void _after_fork(void) {
+    if (_default_auto && _default.seeded) {
+        _init(&_default, _default.engine);
+        ojr_seed_r(&_default, 0);
+    }
+}
+#endif
+
+static void _watch_forks(void) {
+#ifndef _WIN32
+    static int registered;
+
+    if (! registered) {
+        pthread_atfork(0, 0, _after_fork);
+        registered = 1;
+    }
+#endif
+}
+
+static ojr_state *_dflt(void) {
+    if (! _default.seeded) {
+        _init(&_default, _default.engine);
+        ojr_seed_r(&_default, 0);
+    }
+    return &_default;
+}
+
+// Drop any seed, so the default state will be seeded from system entropy
+// when next used.
+void _ojr_lazy_default(void) {
+    _watch_forks();
+    _default.seeded = 0;
+}
+
+extern void _ojr_chacha20_mix(uint32_t *, const uint32_t *);
+
+/* Seed from a string of bytes of any length, all of which count: they are
+ * condensed to 256 bits 16 at a time with the ChaCha20 block function,
+ * then the length, and those bits set up JKISS and the selected engine.
+ * The same bytes always give the same output.
+ */
+int ojr_seed_bytes_r(ojr_state *s, const void *bytes, int len) {
+    const unsigned char *bp = bytes;
+    uint32_t e[8] = { 0 }, m[4];
+    int i, j;
+    assert(0 != s && 0x10ACE0FF == s->_johnnymoss);
+    assert(len >= 0 && (0 == len || 0 != bytes));
+
+    for (i = 0; i < len; i += 16) {
+        memset(m, 0, sizeof(m));
+        for (j = 0; j < 16 && i + j < len; ++j) {
+            m[j >> 2] |= (uint32_t)bp[i + j] << (8 * (j & 3));
+        }
+        _ojr_chacha20_mix(e, m);
+    }
+    m[0] = (uint32_t)len;
+    m[1] = 0;
+    m[2] = m[3] = 0x4F4A5253;
+    _ojr_chacha20_mix(e, m);
+
+    s->left = 0;
+    _jkiss_from(s, e);
+    s->seeded = 1;
+    _ojr_engines[s->engine].key(s, e);
+    if (&_default == s) _default_auto = 0;
     return 0;
 }
 
-// Need more random bits.
-static void reload(void) {
+int ojr_seed_bytes(const void *bytes, int len) {
+    return ojr_seed_bytes_r(&_default, bytes, len);
+}
+
+static void (*_reload4)(ojr_state *);
+
+// Need more random bits. First note what will produce them, for
+// ojr_get_state_r().
+static void reload(ojr_state *s) {
+    assert(s->seeded);
+    s->px = s->x; s->py = s->y;
+    s->pz1 = s->z1; s->pc1 = s->c1; s->pz2 = s->z2; s->pc2 = s->c2;
+    memcpy(s->plane, s->lane, sizeof(s->lane));
+    s->pes = s->es;
+
+    _ojr_engines[s->engine].reload(s);
+    s->left = 4 * OJR_RING_WORDS;
+}
+
+static void _key_jkiss(ojr_state *s, const uint32_t *e) {
+    (void)s; (void)e;
+}
+
+static void _reload_jkiss(ojr_state *s) {
     int i;
     uint64_t t;
 
-    assert(_seeded);
-    for (i = 0; i < (RB_SIZE / 8); ++i) {
-        x = 1490024343005336237ull * x + 123456789;
+    for (i = 0; i < OJR_RING_WORDS; ++i) {
+        s->x = _LCGA * s->x + _LCGC;
+
+        s->y ^= s->y << 21;
+        s->y ^= s->y >> 17;
+        s->y ^= s->y << 30;
+
+        t = _MWC1 * s->z1 + s->c1;
+        s->c1 = t >> 32;
+        s->z1 = t;
+
+        t = _MWC2 * s->z2 + s->c2;
+        s->c2 = t >> 32;
+        s->z2 = t;
+
+        s->ring.u64[i] = s->x + s->y + s->z1 + ((uint64_t)s->z2 << 32);
+    }
+}
+
+/* JKISS4: four independent JKISS generators run side by side in vector
+ * registers, filling the ring in turn, so that a refill is a quarter as
+ * many serial steps. The lanes start 2^62 outputs apart in the sequence
+ * of the state they were split from. This is a different sequence from
+ * plain JKISS, so it is never the default; ask for it with
+ * ojr_set_engine_r(). On x86 there is an AVX2 build of the refill, picked
+ * at run time if the CPU has it.
+ */
+#if defined(__GNUC__)
+#define _OJR_VECTOR 1
+typedef uint64_t _v4u64 __attribute__((vector_size(32)));
+
+static inline __attribute__((always_inline)) void _reload4_body(ojr_state *s) {
+    _v4u64 x, y, z1, c1, z2, c2, t, out;
+    const _v4u64 lo32 = { 0xFFFFFFFFull, 0xFFFFFFFFull, 0xFFFFFFFFull,
+        0xFFFFFFFFull };
+
+    for (int k = 0; k < 4; ++k) {
+        x[k] = s->lane[k].x;
+        y[k] = s->lane[k].y;
+        z1[k] = s->lane[k].z1;
+        c1[k] = s->lane[k].c1;
+        z2[k] = s->lane[k].z2;
+        c2[k] = s->lane[k].c2;
+    }
+    for (int i = 0; i < OJR_RING_WORDS; i += 4) {
+        x = x * _LCGA + _LCGC;
 
         y ^= y << 21;
         y ^= y >> 17;
         y ^= y << 30;
 
-        t = 4294584393ull * z1 + c1;
+        t = z1 * _MWC1 + c1;
         c1 = t >> 32;
-        z1 = t;
+        z1 = t & lo32;
 
-        t = 4246477509ull * z2 + c2;
+        t = z2 * _MWC2 + c2;
         c2 = t >> 32;
-        z2 = t;
+        z2 = t & lo32;
 
-        ((uint64_t *)ring)[i] = x + y + z1 + ((uint64_t)z2 << 32);
+        out = x + y + z1 + (z2 << 32);
+        memcpy(s->ring.u64 + i, &out, sizeof(out));
+    }
+    for (int k = 0; k < 4; ++k) {
+        s->lane[k].x = x[k];
+        s->lane[k].y = y[k];
+        s->lane[k].z1 = (uint32_t)z1[k];
+        s->lane[k].c1 = (uint32_t)c1[k];
+        s->lane[k].z2 = (uint32_t)z2[k];
+        s->lane[k].c2 = (uint32_t)c2[k];
     }
-    rptr = ring + (RB_SIZE / 2);
 }
 
-// Return next 16, 32, 64 random bits from buffer.
-uint16_t ojr_next16(void) {
-    assert(_seeded);
-    if (rptr == ring) reload();
-    return *--rptr;
+static void _reload4_generic(ojr_state *s) { _reload4_body(s); }
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("avx2")))
+static void _reload4_avx2(ojr_state *s) { _reload4_body(s); }
+#endif
+
+#else /* No vector extensions: same lanes, one at a time. */
+
+static void _reload4_generic(ojr_state *s) {
+    for (int i = 0; i < OJR_RING_WORDS; ++i) {
+        s->ring.u64[i] = _jkiss_step(s->lane + (i & 3));
+    }
 }
 
-uint32_t ojr_next32(void) {
-    assert(_seeded);
-    if (rptr < (ring + 2)) reload();
-    rptr -= 2;
-    return *((uint32_t *)rptr);
+#endif /* __GNUC__ */
+
+static void _pick_reload4(void) {
+    _reload4 = _reload4_generic;
+#if defined(_OJR_VECTOR) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) _reload4 = _reload4_avx2;
+#endif
 }
 
-uint64_t ojr_next64(void) {
-    assert(_seeded);
-    if (rptr < (ring + 4)) reload();
-    rptr -= 4;
-    return *((uint64_t *)rptr);
+static void _jump_vars(uint64_t *, uint64_t *, uint32_t *, uint32_t *,
+    uint32_t *, uint32_t *, uint64_t, uint64_t);
+
+// Start the four lanes 2^62 outputs apart from the JKISS variables.
+static void _key_jkiss4(ojr_state *s, const uint32_t *e) {
+    ojr_lane l = { s->x, s->y, s->z1, s->c1, s->z2, s->c2 };
+
+    (void)e;
+    if (0 == _reload4) _pick_reload4();
+    for (int k = 0; k < 4; ++k) {
+        s->lane[k] = l;
+        _jump_vars(&l.x, &l.y, &l.z1, &l.c1, &l.z2, &l.c2, 1ull << 62, 0);
+    }
+}
+
+static void _reload_jkiss4(ojr_state *s) {
+    if (0 == _reload4) _pick_reload4();
+    _reload4(s);
+}
+
+/* Select the engine that refills the ring, keyed from the JKISS variables
+ * so that the same seed gives the same output. To key it from system
+ * entropy instead, seed with 0 after selecting it. Returns 0 or negative
+ * error code.
+ */
+int ojr_set_engine_r(ojr_state *s, int engine) {
+    uint32_t e[8];
+    assert(0 != s && 0x10ACE0FF == s->_johnnymoss);
+
+    if (engine < 0 || engine >= OJR_NENGINES) return OJE_BADINDEX;
+    if (0 == _ojr_engines[engine].reload) return OJE_BADINDEX;
+
+    _jkiss_key(s, e);
+    s->engine = engine;
+    _ojr_engines[engine].key(s, e);
+    s->left = 0;
+    return 0;
+}
+
+int ojr_set_engine(int engine) {
+    return ojr_set_engine_r(_dflt(), engine);
+}
+
+int ojr_get_engine_r(ojr_state *s) { return s->engine; }
+int ojr_get_engine(void) { return _default.engine; }
+
+int ojr_engine_count(void) { return OJR_NENGINES; }
+
+// Fill in information about the given engine.
+int ojr_engine_info(int id, oj_rng_engine_info *ip) {
+    const struct _ojr_engine *ep;
+    assert(0 != ip);
+
+    if (id < 0 || id >= OJR_NENGINES) return OJE_BADINDEX;
+    ep = &_ojr_engines[id];
+
+    ip->_johnnymoss = 0x10ACE0FF;
+    ip->id = id;
+    ip->available = (0 != ep->reload);
+    ip->name = ep->name;
+    ip->description = ep->description;
+    return 0;
+}
+
+/* Return next 16, 32, 64 random bits from buffer. The buffer is used from
+ * the top down, 16 bits at a time; wider values are the next 2 or 4 of
+ * those taken together, which may not be aligned, hence memcpy().
+ */
+uint16_t ojr_next16_r(ojr_state *s) {
+    assert(s->seeded);
+    if (0 == s->left) reload(s);
+    return s->ring.u16[--s->left];
+}
+
+uint32_t ojr_next32_r(ojr_state *s) {
+    uint32_t v;
+    assert(s->seeded);
+
+    if (s->left < 2) reload(s);
+    s->left -= 2;
+    memcpy(&v, s->ring.u16 + s->left, sizeof(v));
+    return v;
+}
+
+uint64_t ojr_next64_r(ojr_state *s) {
+    uint64_t v;
+    assert(s->seeded);
+
+    if (s->left < 4) reload(s);
+    s->left -= 4;
+    memcpy(&v, s->ring.u16 + s->left, sizeof(v));
+    return v;
 }
 
 // For those of you into floating point, return one in [0,1).
 // Assumes ieee-64 floating point format.
-static union {
-    double d;
-    uint64_t i;
-} ieee;
-
-double ojr_next_double(void) {
-    uint64_t r = ojr_next64();
-    ieee.i = (r >> 12) | 0x3FF0000000000000;
+double ojr_next_double_r(ojr_state *s) {
+    union {
+        double d;
+        uint64_t i;
+    } ieee;
+
+    ieee.i = (ojr_next64_r(s) >> 12) | 0x3FF0000000000000;
     return ieee.d - 1.0;
 }
 
-// Return a well-balanced random integer from 0 to limit-1. Limited to 16 bits!
-int ojr_rand(int limit) {
-    int v, m = limit - 1;
-    assert(_seeded);
+/* Return a well-balanced random integer from 0 to limit-1, by Lemire's
+ * multiply-shift ("Fast Random Integer Generation in an Interval", 2019):
+ * the high half of x * limit is in range, and it is only biased when the
+ * low half falls below 2^w mod limit, which we then reject. That is rare,
+ * and the division to find it only happens on the rare path. Small limits
+ * take 16-bit draws to go easy on the ring buffer; for them a reject
+ * costs at most one in 256.
+ */
+static inline uint32_t _rand16(ojr_state *s, uint32_t limit) {
+    uint32_t m = (uint32_t)ojr_next16_r(s) * limit;
+    uint16_t t;
+
+    if ((uint16_t)m < limit) {
+        t = (uint16_t)(0x10000 - limit) % limit;
+        while ((uint16_t)m < t) m = (uint32_t)ojr_next16_r(s) * limit;
+    }
+    return m >> 16;
+}
+
+static inline uint32_t _rand32(ojr_state *s, uint32_t limit) {
+    uint64_t m = (uint64_t)ojr_next32_r(s) * limit;
+    uint32_t t;
+
+    if ((uint32_t)m < limit) {
+        t = -limit % limit;
+        while ((uint32_t)m < t) m = (uint64_t)ojr_next32_r(s) * limit;
+    }
+    return m >> 32;
+}
+
+// High and low halves of a 64x64-bit product.
+static inline uint64_t _mul64(uint64_t a, uint64_t b, uint64_t *lo) {
+#ifdef OJ_HAVE_INT128
+    oj_uint128 m = (oj_uint128)a * b;
+
+    *lo = (uint64_t)m;
+    return (uint64_t)(m >> 64);
+#else
+    uint64_t a0 = (uint32_t)a, a1 = a >> 32, b0 = (uint32_t)b, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+
+    *lo = (mid << 32) | (uint32_t)p00;
+    return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+}
+
+uint32_t ojr_rand32_r(ojr_state *s, uint32_t limit) {
+    assert(s->seeded);
     assert(limit > 0);
-    assert(limit < 65536);
 
-    m |= m >> 1;
-    m |= m >> 2;
-    m |= m >> 4;
-    m |= m >> 8;
+    if (limit <= 256) return _rand16(s, limit);
+    return _rand32(s, limit);
+}
 
-    do {
-        if (rptr == ring) reload();
-        v = m & *--rptr;
-    } while (v >= limit);
+uint64_t ojr_rand64_r(ojr_state *s, uint64_t limit) {
+    uint64_t hi, lo, t;
+    assert(s->seeded);
+    assert(limit > 0);
+
+    if (limit <= 0xFFFFFFFFull) return ojr_rand32_r(s, (uint32_t)limit);
+
+    hi = _mul64(ojr_next64_r(s), limit, &lo);
+    if (lo < limit) {
+        t = -limit % limit;
+        while (lo < t) hi = _mul64(ojr_next64_r(s), limit, &lo);
+    }
+    return hi;
+}
+
+int ojr_rand_r(ojr_state *s, int limit) {
+    assert(limit > 0);
+    return (int)ojr_rand32_r(s, (uint32_t)limit);
+}
+
+// Fill <out> with <n> random integers from 0 to limit-1. The threshold is
+// found at most once for the whole batch.
+int ojr_rand_many_r(ojr_state *s, uint32_t limit, uint32_t *out, int n) {
+    uint64_t m;
+    uint32_t t = 0;
+    int have = 0;
+    assert(s->seeded);
+    assert(limit > 0 && 0 != out);
+
+    if (limit <= 256) {
+        for (int i = 0; i < n; ++i) out[i] = _rand16(s, limit);
+        return n;
+    }
+    for (int i = 0; i < n; ++i) {
+        m = (uint64_t)ojr_next32_r(s) * limit;
+        if ((uint32_t)m < limit) {
+            if (! have) {
+                t = -limit % limit;
+                have = 1;
+            }
+            while ((uint32_t)m < t) m = (uint64_t)ojr_next32_r(s) * limit;
+        }
+        out[i] = m >> 32;
+    }
+    return n;
+}
+
+/* Fisher-Yates indices: fill out[m] with a random integer from 0 to
+ * n-m-1, for m from 0 to count-1. Several come from each 64-bit draw
+ * (Brackett-Rozinsky and Lemire, "Batched Ranged Random Integer
+ * Generation", 2024): multiplying by each bound in turn peels off one
+ * index as the high word and leaves the low word for the next. Over a
+ * whole group the result is uniform unless the last low word falls below
+ * 2^64 mod the product of the bounds, and we redraw the group when it
+ * does. Keeping products to 2^56 makes that at most one in 256.
+ */
+#define _OJR_BATCH_MAX (1ull << 56)
+
+// Number of indices to draw together starting at out[m], and the product
+// of their bounds. Test against the limit by division so the product
+// itself never overflows.
+int _ojr_batch_group(uint32_t n, int m, int count, uint64_t *prod) {
+    int k;
+
+    *prod = n - m;
+    for (k = 1; m + k < count; ++k) {
+        if (*prod > _OJR_BATCH_MAX / (n - m - k)) break;
+        *prod *= n - m - k;
+    }
+    return k;
+}
+
+int ojr_rand_descending_r(ojr_state *s, uint32_t n, uint32_t *out,
+    int count) {
+    uint64_t prod, r, lo;
+    int k, m;
+    assert(s->seeded);
+    assert(0 != out && count >= 0 && (uint64_t)count <= n);
+
+    for (m = 0; m < count; m += k) {
+        k = _ojr_batch_group(n, m, count, &prod);
+        do {
+            r = ojr_next64_r(s);
+            for (int i = 0; i < k; ++i) {
+                out[m + i] = (uint32_t)_mul64(r, n - m - i, &lo);
+                r = lo;
+            }
+        } while (r < prod && r < -prod % prod);
+    }
+    return count;
+}
+
+int ojr_rand_descending(uint32_t n, uint32_t *out, int count) {
+    return ojr_rand_descending_r(_dflt(), n, out, count);
+}
+
+uint16_t ojr_next16(void) { return ojr_next16_r(_dflt()); }
+uint32_t ojr_next32(void) { return ojr_next32_r(_dflt()); }
+uint64_t ojr_next64(void) { return ojr_next64_r(_dflt()); }
+double ojr_next_double(void) { return ojr_next_double_r(_dflt()); }
+int ojr_rand(int limit) { return ojr_rand_r(_dflt(), limit); }
+uint32_t ojr_rand32(uint32_t limit) { return ojr_rand32_r(_dflt(), limit); }
+uint64_t ojr_rand64(uint64_t limit) { return ojr_rand64_r(_dflt(), limit); }
+int ojr_rand_many(uint32_t limit, uint32_t *out, int n) {
+    return ojr_rand_many_r(_dflt(), limit, out, n);
+}
+
+/* Jumping ahead. Each step of the generator (one 64-bit word of output)
+ * advances its four parts independently, and each can be advanced n steps
+ * in O(log n) time:
+ *
+ * LCG x' = ax + c (mod 2^64): n steps is again a map x -> Ax + C, found by
+ *     composing the map with itself by repeated squaring.
+ * Xorshift: y' = My for a 64x64 matrix M over GF(2), so n steps is M^n,
+ *     again by repeated squaring. M has order 2^64 - 1.
+ * MWC z' = (az + c) mod 2^32, c' = (az + c) div 2^32: with Y = c 2^32 + z
+ *     this is just Y' = aY mod (a 2^32 - 1), so n steps multiplies Y by
+ *     a^n mod that.
+ *
+ * Distances are 128 bits, hi 2^64 + lo. Jumping drops anything left in
+ * the ring buffer.
+ */
+
+// Apply the linear map with the given columns to v.
+static uint64_t _gf2_apply(const uint64_t *cols, uint64_t v) {
+    uint64_t r = 0;
+
+    for (int j = 0; v; ++j, v >>= 1) {
+        if (v & 1) r ^= cols[j];
+    }
+    return r;
+}
+
+static uint64_t _xorshift(uint64_t y) {
+    y ^= y << 21;
+    y ^= y >> 17;
+    y ^= y << 30;
+    return y;
+}
+
+// y = M^e y
+static uint64_t _xorshift_jump(uint64_t y, uint64_t e) {
+    uint64_t p[64], q[64];
+    int j;
+
+    for (j = 0; j < 64; ++j) p[j] = _xorshift(1ull << j);
+    while (e) {
+        if (e & 1) y = _gf2_apply(p, y);
+        if (e >>= 1) {
+            for (j = 0; j < 64; ++j) q[j] = _gf2_apply(p, p[j]);
+            memcpy(p, q, sizeof(p));
+        }
+    }
+    return y;
+}
+
+// a * b mod m
+static uint64_t _mulmod(uint64_t a, uint64_t b, uint64_t m) {
+#ifdef OJ_HAVE_INT128
+    return (uint64_t)(((oj_uint128)a * b) % m);
+#else
+    uint64_t r = 0;
+
+    a %= m;
+    while (b) {
+        if (b & 1) r = (r >= m - a) ? r - (m - a) : r + a;
+        a = (a >= m - a) ? a - (m - a) : a + a;
+        b >>= 1;
+    }
+    return r;
+#endif
+}
+
+// Advance MWC state (z, c) with multiplier a by hi 2^64 + lo steps.
+static void _mwc_jump(uint32_t *z, uint32_t *c, uint64_t a, uint64_t lo,
+    uint64_t hi) {
+    uint64_t m = (a << 32) - 1, p = a, r = 1, y;
+
+    for (int i = 0; i < 128; ++i) {
+        if (((i < 64) ? (lo >> i) : (hi >> (i - 64))) & 1) r = _mulmod(r, p, m);
+        p = _mulmod(p, p, m);
+    }
+    y = _mulmod(((uint64_t)*c << 32) | *z, r, m);
+    *z = (uint32_t)y;
+    *c = (uint32_t)(y >> 32);
+}
+
+static void _jump_vars(uint64_t *x, uint64_t *y, uint32_t *z1, uint32_t *c1,
+    uint32_t *z2, uint32_t *c2, uint64_t lo, uint64_t hi) {
+    uint64_t a = _LCGA, c = _LCGC, ma = 1, mc = 0, e;
+
+    // LCG: the period is 2^64, so only lo matters.
+    for (e = lo; e; e >>= 1) {
+        if (e & 1) {
+            mc = a * mc + c;
+            ma = a * ma;
+        }
+        c = a * c + c;
+        a = a * a;
+    }
+    *x = ma * *x + mc;
+
+    // Xorshift: 2^64 = 1 mod 2^64 - 1, so the distance is lo + hi.
+    e = lo + hi;
+    if (e < lo) ++e;
+    if (e == ~0ull) e = 0;
+    *y = _xorshift_jump(*y, e);
+
+    _mwc_jump(z1, c1, _MWC1, lo, hi);
+    _mwc_jump(z2, c2, _MWC2, lo, hi);
+}
+
+static void _jump_jkiss(ojr_state *s, uint64_t lo, uint64_t hi) {
+    ojr_lane *l;
+
+    if (OJR_ENGINE_JKISS4 == s->engine) {
+        for (int k = 0; k < 4; ++k) {
+            l = s->lane + k;
+            _jump_vars(&l->x, &l->y, &l->z1, &l->c1, &l->z2, &l->c2, lo, hi);
+        }
+    } else {
+        _jump_vars(&s->x, &s->y, &s->z1, &s->c1, &s->z2, &s->c2, lo, hi);
+    }
+}
+
+static void _jump(ojr_state *s, uint64_t lo, uint64_t hi) {
+    _ojr_engines[s->engine].jump(s, lo, hi);
+    s->left = 0;
+}
+
+// Jump <n> 64-bit words ahead in the generator's output. With JKISS4 each
+// lane moves <n> ahead, which is 4n words of output; ChaCha20 and Philox
+// round up to a whole block.
+void ojr_jump_r(ojr_state *s, uint64_t n) {
+    assert(0 != s && s->seeded);
+    _jump(s, n, 0);
+}
+
+void ojr_jump(uint64_t n) { ojr_jump_r(_dflt(), n); }
+
+/* Seed one of many independent streams: stream k is the generator seeded
+ * with <seed>, jumped ahead k 2^64 words, so no run will ever overlap
+ * another stream. With a nonzero seed the same (seed, stream) always
+ * gives the same output.
+ */
+int ojr_seed_stream_r(ojr_state *s, int seed, uint64_t stream) {
+    int r;
+
+    assert(0 != s);
+    _init(s, (0x10ACE0FF == s->_johnnymoss) ? s->engine : OJR_ENGINE_JKISS);
+    if (0 != (r = ojr_seed_r(s, seed))) return r;
+
+    if (stream) _jump(s, 0, stream);
+    return 0;
+}
+
+int ojr_seed_stream(int seed, uint64_t stream) {
+    return ojr_seed_stream_r(&_default, seed, stream);
+}
+
+/* Save and restore the exact position of the generator, so that a run
+ * can be replayed from a log without generating all that came before. The
+ * state is written in OJR_STATE_SIZE bytes, little-endian, the same on any
+ * machine: the variables that will produce the current ring buffer, and
+ * how far into it we are.
+ *
+ *  0  "OJRS"                8  JKISS x, y (8 each)
+ *  4  version (1)          24  JKISS z1, c1, z2, c2 (4 each)
+ *  5  engine (1)           40  engine state, by engine:
+ *  6  16-bit words left (2)     JKISS4: 4 lanes as above (128)
+ *                               xoshiro, pcg64: 4 words (8 each)
+ *                               chacha20: key, counter (4 each, 12)
+ *                               philox: counter, key (4 each, 6)
+ *
+ * Unused bytes are zero.
+ */
+#define _OJR_STATE_VERSION 1
+
+static void _put(unsigned char *p, uint64_t v, int n) {
+    for (int i = 0; i < n; ++i, v >>= 8) p[i] = (unsigned char)v;
+}
+
+static uint64_t _get(const unsigned char *p, int n) {
+    uint64_t v = 0;
+    for (int i = n - 1; i >= 0; --i) v = (v << 8) | p[i];
     return v;
 }
 
+static void _put_lane(unsigned char *p, const ojr_lane *l) {
+    _put(p, l->x, 8);
+    _put(p + 8, l->y, 8);
+    _put(p + 16, l->z1, 4);
+    _put(p + 20, l->c1, 4);
+    _put(p + 24, l->z2, 4);
+    _put(p + 28, l->c2, 4);
+}
+
+static void _get_lane(const unsigned char *p, ojr_lane *l) {
+    l->x = _get(p, 8);
+    l->y = _get(p + 8, 8);
+    l->z1 = (uint32_t)_get(p + 16, 4);
+    l->c1 = (uint32_t)_get(p + 20, 4);
+    l->z2 = (uint32_t)_get(p + 24, 4);
+    l->c2 = (uint32_t)_get(p + 28, 4);
+}
+
+// Write the state of generator <s> into buf. Returns the number of bytes
+// written or negative error code.
+int ojr_get_state_r(ojr_state *s, unsigned char *buf, int size) {
+    ojr_lane l;
+    const ojr_lane *lanes = s->lane;
+    const uint64_t *w64 = s->es.xo;
+    const uint32_t *w32 = s->es.chacha;
+    assert(0 != s && s->seeded && 0 != buf);
+
+    if (size < OJR_STATE_SIZE) return OJE_FULL;
+    if (s->left) {
+        l.x = s->px; l.y = s->py;
+        l.z1 = s->pz1; l.c1 = s->pc1; l.z2 = s->pz2; l.c2 = s->pc2;
+        lanes = s->plane;
+        w64 = s->pes.xo;
+        w32 = s->pes.chacha;
+    } else {
+        l.x = s->x; l.y = s->y;
+        l.z1 = s->z1; l.c1 = s->c1; l.z2 = s->z2; l.c2 = s->c2;
+    }
+    memset(buf, 0, OJR_STATE_SIZE);
+    memmove(buf, "OJRS", 4);
+    buf[4] = _OJR_STATE_VERSION;
+    buf[5] = (unsigned char)s->engine;
+    _put(buf + 6, s->left, 2);
+    _put_lane(buf + 8, &l);
+
+    switch (s->engine) {
+    case OJR_ENGINE_JKISS4:
+        for (int k = 0; k < 4; ++k) _put_lane(buf + 40 + 32 * k, lanes + k);
+        break;
+    case OJR_ENGINE_XOSHIRO:
+    case OJR_ENGINE_PCG64:
+        for (int i = 0; i < 4; ++i) _put(buf + 40 + 8 * i, w64[i], 8);
+        break;
+    case OJR_ENGINE_CHACHA20:
+        for (int i = 0; i < 12; ++i) _put(buf + 40 + 4 * i, w32[4 + i], 4);
+        break;
+    case OJR_ENGINE_PHILOX:
+        for (int i = 0; i < 6; ++i) _put(buf + 40 + 4 * i, w32[i], 4);
+        break;
+    }
+    return OJR_STATE_SIZE;
+}
+
+int ojr_get_state(unsigned char *buf, int size) {
+    return ojr_get_state_r(_dflt(), buf, size);
+}
+
+// Set generator <s> to a state written by ojr_get_state_r(). The state
+// need not have been initialized. Returns 0 or negative error code.
+int ojr_set_state_r(ojr_state *s, const unsigned char *buf, int size) {
+    static const uint32_t zero[8];
+    ojr_lane l;
+    int engine, left;
+    assert(0 != s && 0 != buf);
+
+    if (size < OJR_STATE_SIZE || 0 != memcmp(buf, "OJRS", 4) ||
+        _OJR_STATE_VERSION != buf[4]) return OJE_BADINDEX;
+    engine = buf[5];
+    left = (int)_get(buf + 6, 2);
+    if (engine >= OJR_NENGINES || 0 == _ojr_engines[engine].reload ||
+        left > 4 * OJR_RING_WORDS) return OJE_BADINDEX;
+
+    _init(s, engine);
+    _get_lane(buf + 8, &l);
+    s->x = l.x; s->y = l.y;
+    s->z1 = l.z1; s->c1 = l.c1; s->z2 = l.z2; s->c2 = l.c2;
+
+    switch (engine) {
+    case OJR_ENGINE_JKISS4:
+        for (int k = 0; k < 4; ++k) _get_lane(buf + 40 + 32 * k, s->lane + k);
+        break;
+    case OJR_ENGINE_XOSHIRO:
+    case OJR_ENGINE_PCG64:
+        for (int i = 0; i < 4; ++i) s->es.xo[i] = _get(buf + 40 + 8 * i, 8);
+        break;
+    case OJR_ENGINE_CHACHA20:
+        _ojr_chacha20_key(s, zero);     // For the constants
+        for (int i = 0; i < 12; ++i) {
+            s->es.chacha[4 + i] = (uint32_t)_get(buf + 40 + 4 * i, 4);
+        }
+        break;
+    case OJR_ENGINE_PHILOX:
+        for (int i = 0; i < 6; ++i) {
+            s->es.philox[i] = (uint32_t)_get(buf + 40 + 4 * i, 4);
+        }
+        break;
+    }
+    s->seeded = 1;
+    if (&_default == s) _default_auto = 0;
+
+    if (left) {
+        reload(s);
+        s->left = left;
+    }
+    return 0;
+}
+
+int ojr_set_state(const unsigned char *buf, int size) {
+    return ojr_set_state_r(&_default, buf, size);
+}
@@ -0,0 +1,178 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Sampling combinations without repeats. ojc_next_random() draws each hand
+ * independently, which is fine for plain Monte Carlo but repeats hands.
+ * A sampler instead maps sample numbers 0, 1, 2... to distinct colex ranks
+ * of a combiner with a function that needs no memory of what has come
+ * before, so any sample can also be had directly by its number:
+ *
+ * OJC_SAMPLE_PERMUTE: a keyed pseudo-random permutation of the ranks, a
+ *     small Feistel network over the next power of four up, cycle-walked
+ *     back into range.
+ * OJC_SAMPLE_STRATIFIED: ranks are split into <count> equal runs, and one
+ *     sample is drawn at random from each.
+ * OJC_SAMPLE_LATTICE: a rank-1 lattice, rank = start + i * step mod total
+ *     with step near total / golden ratio, which spreads any prefix of the
+ *     samples evenly over the ranks (low discrepancy) and visits every
+ *     rank once in a full cycle.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "ojcardlib.h"
+
+// Good 64-bit avalanche mix (Stafford's variant 13, as in SplitMix64).
+static inline uint64_t _mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// High 64 bits of a 64x64-bit product, which scales a random 64-bit
+// value into [0, b).
+static inline uint64_t _mulhi(uint64_t a, uint64_t b) {
+#ifdef OJ_HAVE_INT128
+    return (uint64_t)(((oj_uint128)a * b) >> 64);
+#else
+    uint64_t al = a & 0xFFFFFFFFull, ah = a >> 32;
+    uint64_t bl = b & 0xFFFFFFFFull, bh = b >> 32;
+    uint64_t t = ah * bl + ((al * bl) >> 32);
+    uint64_t u = al * bh + (t & 0xFFFFFFFFull);
+    return ah * bh + (t >> 32) + (u >> 32);
+#endif
+}
+
+// a * b mod m, for a, b < m < 2^63.
+static inline uint64_t _mulmod(uint64_t a, uint64_t b, uint64_t m) {
+#ifdef OJ_HAVE_INT128
+    return (uint64_t)(((oj_uint128)a * b) % m);
+#else
+    uint64_t r = 0;
+
+    while (b) {
+        if (b & 1) r = (r + a) % m;
+        a = (a << 1) % m;
+        b >>= 1;
+    }
+    return r;
+#endif
+}
+
+static uint64_t _gcd(uint64_t a, uint64_t b) {
+    uint64_t t;
+
+    while (b) {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Four Feistel rounds on a 2h-bit value: a bijection on [0, 4^h).
+static uint64_t _feistel(oj_sampler *sp, uint64_t x) {
+    int h = sp->halfbits;
+    uint64_t t, m = (1ull << h) - 1, l = x >> h, r = x & m;
+
+    for (int i = 0; i < 4; ++i) {
+        t = r;
+        r = l ^ (_mix(r ^ sp->key[i]) & m);
+        l = t;
+    }
+    return (l << h) | r;
+}
+
+// Initialize a sampler of <count> hands (0 means all of them) from the
+// combinations of combiner <cp>, which supplies the deck and the hand. The
+// keys come from generator <rs>.
+int ojc_sampler_new_r(oj_sampler *sp, oj_combiner *cp, int mode,
+    int64_t count, ojr_state *rs) {
+    int64_t total;
+    uint64_t step;
+    int b;
+    assert(0 != sp && 0 != cp && 0x10ACE0FF == cp->_johnnymoss);
+
+    total = cp->total;
+    if (0 == count) count = total;
+    if (count < 0 || count > total) return OJE_BADINDEX;
+    if (mode < OJC_SAMPLE_PERMUTE || mode > OJC_SAMPLE_LATTICE) {
+        return OJE_BADINDEX;
+    }
+    sp->_johnnymoss = 0x10ACE0FF;
+    sp->comb = cp;
+    sp->mode = mode;
+    sp->total = total;
+    sp->count = count;
+    sp->index = 0;
+
+    for (int i = 0; i < 4; ++i) sp->key[i] = ojr_next64_r(rs);
+    for (b = 1; (1ll << b) < total; ++b) ;
+    sp->halfbits = (b + 1) >> 1;
+
+    // Start anywhere; step is the coprime of total nearest total / phi.
+    sp->start = (int64_t)ojr_rand64_r(rs, (uint64_t)total);
+    step = (uint64_t)((double)total * 0.6180339887498949);
+    if (step < 1) step = 1;
+    for (int d = 0; ; ++d) {
+        if (step + d < (uint64_t)total && 1 == _gcd(step + d, total)) {
+            step += d;
+            break;
+        }
+        if (step > (uint64_t)d && 1 == _gcd(step - d, total)) {
+            step -= d;
+            break;
+        }
+    }
+    sp->step = (int64_t)step;
+    return 0;
+}
+
+int ojc_sampler_new(oj_sampler *sp, oj_combiner *cp, int mode, int64_t count) {
+    return ojc_sampler_new_r(sp, cp, mode, count, ojr_default_state());
+}
+
+// Colex rank of sample number <i>, or -1 if there is no such sample.
+int64_t ojc_sampler_rank_at(oj_sampler *sp, int64_t i) {
+    uint64_t x, q, r, first, size;
+    assert(0 != sp && 0x10ACE0FF == sp->_johnnymoss);
+
+    if (i < 0 || i >= sp->count) return -1LL;
+
+    switch (sp->mode) {
+    case OJC_SAMPLE_PERMUTE:
+        x = (uint64_t)i;
+        do {
+            x = _feistel(sp, x);
+        } while (x >= (uint64_t)sp->total);
+        return (int64_t)x;
+    case OJC_SAMPLE_STRATIFIED:
+        q = sp->total / sp->count;
+        r = sp->total % sp->count;
+        first = q * i + (((uint64_t)i < r) ? (uint64_t)i : r);
+        size = q + ((uint64_t)i < r);
+        return (int64_t)(first + _mulhi(_mix(sp->key[1] + i), size));
+    case OJC_SAMPLE_LATTICE:
+        x = _mulmod((uint64_t)i, (uint64_t)sp->step, sp->total);
+        return (int64_t)((x + sp->start) % sp->total);
+    }
+    return -1LL;
+}
+
+// Put the next sample into the combiner's hand; 0 when done.
+int ojc_sampler_next(oj_sampler *sp) {
+    int64_t rank;
+    assert(0 != sp && 0x10ACE0FF == sp->_johnnymoss);
+
+    if (sp->index >= sp->count) return 0;
+    rank = ojc_sampler_rank_at(sp, sp->index++);
+    ojc_colex_hand_at(sp->comb, rank, sp->comb->hand);
+    return 1;
+}
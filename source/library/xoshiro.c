@@ -0,0 +1,101 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Xoshiro256** by David Blackman and Sebastiano Vigna (public domain).
+ * <http://prng.di.unimi.it/> The fastest of the engines, with 256 bits of
+ * state and no known statistical weaknesses; fine for simulation, but
+ * easily predicted from its output, so not for dealing real games.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#include "ojcardlib.h"
+
+static inline uint64_t _rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// Key from 256 bits of seed. The all-zero state is the one to avoid.
+void _ojr_xoshiro_key(ojr_state *s, const uint32_t *e) {
+    for (int i = 0; i < 4; ++i) {
+        s->es.xo[i] = ((uint64_t)e[2 * i + 1] << 32) | e[2 * i];
+    }
+    if (0 == (s->es.xo[0] | s->es.xo[1] | s->es.xo[2] | s->es.xo[3])) {
+        s->es.xo[0] = 0x9E3779B97F4A7C15ull;
+    }
+}
+
+void _ojr_xoshiro_reload(ojr_state *s) {
+    uint64_t s0 = s->es.xo[0], s1 = s->es.xo[1],
+        s2 = s->es.xo[2], s3 = s->es.xo[3], t;
+
+    for (int i = 0; i < OJR_RING_WORDS; ++i) {
+        s->ring.u64[i] = _rotl(s1 * 5, 7) * 9;
+        t = s1 << 17;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = _rotl(s3, 45);
+    }
+    s->es.xo[0] = s0; s->es.xo[1] = s1;
+    s->es.xo[2] = s2; s->es.xo[3] = s3;
+}
+
+/* Jump. The state update is linear over GF(2), a 256x256 matrix, so as
+ * with the xorshift part of JKISS we raise it to the distance by repeated
+ * squaring. Matrices are kept as 256 columns of 4 words.
+ */
+typedef uint64_t _col[4];
+
+static void _apply(const _col *m, const uint64_t *v, uint64_t *r) {
+    uint64_t w;
+    int j;
+
+    r[0] = r[1] = r[2] = r[3] = 0;
+    for (int i = 0; i < 4; ++i) {
+        for (j = 64 * i, w = v[i]; w; ++j, w >>= 1) {
+            if (w & 1) {
+                r[0] ^= m[j][0]; r[1] ^= m[j][1];
+                r[2] ^= m[j][2]; r[3] ^= m[j][3];
+            }
+        }
+    }
+}
+
+void _ojr_xoshiro_jump(ojr_state *s, uint64_t lo, uint64_t hi) {
+    _col m[256], q[256];
+    uint64_t v[4], t;
+
+    for (int j = 0; j < 256; ++j) {
+        memset(v, 0, sizeof(v));
+        v[j >> 6] = 1ull << (j & 63);
+        t = v[1] << 17;
+        v[2] ^= v[0];
+        v[3] ^= v[1];
+        v[1] ^= v[2];
+        v[0] ^= v[3];
+        v[2] ^= t;
+        v[3] = _rotl(v[3], 45);
+        memcpy(m[j], v, sizeof(v));
+    }
+    while (lo | hi) {
+        if (lo & 1) {
+            _apply((const _col *)m, s->es.xo, v);
+            memcpy(s->es.xo, v, sizeof(v));
+        }
+        lo = (lo >> 1) | (hi << 63);
+        hi >>= 1;
+        if (lo | hi) {
+            for (int j = 0; j < 256; ++j) _apply((const _col *)m, m[j], q[j]);
+            memcpy(m, q, sizeof(q));
+        }
+    }
+}
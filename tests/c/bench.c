@@ -0,0 +1,308 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Speed and quality of the random number engines.
+ *
+ * t_bench [scale]      Nanoseconds per operation for each engine, then
+ *                      throughput in bytes of output and in 52-card
+ *                      shuffles per second, plain and batched.
+ * t_bench -q [count]   Chi-square tests of card positions and adjacent
+ *                      pairs over <count> decks from each engine and each
+ *                      way of shuffling. Fails if any p-value is extreme.
+ * t_bench -s engine    Raw 64-bit output on stdout, never ending, for
+ *                      outside test suites: PractRand "RNG_test stdin64",
+ *                      dieharder "-g 200", or TestU01 reading stdin.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ojcardlib.h"
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+// Keep the compiler from dropping the loops.
+static volatile uint64_t sink;
+
+static oj_card dbuf[52], hbuf[7];
+static oj_cardlist deck, hand;
+
+static void op_next16(ojr_state *s, long n) {
+    uint64_t v = 0;
+    for (long i = 0; i < n; ++i) v ^= ojr_next16_r(s);
+    sink = v;
+}
+
+static void op_next32(ojr_state *s, long n) {
+    uint64_t v = 0;
+    for (long i = 0; i < n; ++i) v ^= ojr_next32_r(s);
+    sink = v;
+}
+
+static void op_next64(ojr_state *s, long n) {
+    uint64_t v = 0;
+    for (long i = 0; i < n; ++i) v ^= ojr_next64_r(s);
+    sink = v;
+}
+
+static void op_rand52(ojr_state *s, long n) {
+    uint64_t v = 0;
+    for (long i = 0; i < n; ++i) v += ojr_rand_r(s, 52);
+    sink = v;
+}
+
+static void op_rand32(ojr_state *s, long n) {
+    uint64_t v = 0;
+    for (long i = 0; i < n; ++i) v += ojr_rand32_r(s, 3000000000u);
+    sink = v;
+}
+
+static void op_shuffle(ojr_state *s, long n) {
+    for (long i = 0; i < n; ++i) ojl_shuffle_r(&deck, s);
+    sink = OJL_GET(&deck, 0);
+}
+
+static void op_batched(ojr_state *s, long n) {
+    for (long i = 0; i < n; ++i) ojl_shuffle_batched_r(&deck, s);
+    sink = OJL_GET(&deck, 0);
+}
+
+static void op_next_random(ojr_state *s, long n) {
+    oj_combiner comb;
+
+    ojc_new(&comb, &deck, &hand, 7, (int64_t)n);
+    while (ojc_next_random_r(&comb, s)) ;
+    sink = OJL_GET(&hand, 0);
+}
+
+static struct {
+    const char *name;
+    long count;
+    void (*fn)(ojr_state *, long);
+} ops[] = {
+    { "next16", 1L << 24, op_next16 },
+    { "next32", 1L << 24, op_next32 },
+    { "next64", 1L << 24, op_next64 },
+    { "rand(52)", 1L << 22, op_rand52 },
+    { "rand32(3e9)", 1L << 22, op_rand32 },
+    { "shuffle 52", 1L << 18, op_shuffle },
+    { "batched 52", 1L << 18, op_batched },
+    { "next_random 7", 1L << 18, op_next_random },
+};
+#define NOPS ((int)(sizeof(ops) / sizeof(ops[0])))
+
+static double timed(void (*fn)(ojr_state *, long), ojr_state *s, long n) {
+    double t = now();
+
+    fn(s, n);
+    return now() - t;
+}
+
+static int speed(int scale) {
+    int i, id;
+    long words = scale * (1L << 24), shuffles = scale * (1L << 20);
+    double t, bps, sps, bsps;
+    oj_rng_engine_info info;
+    ojr_state s;
+
+    printf("ns/op %9s", "");
+    for (id = 0; id < ojr_engine_count(); ++id) {
+        ojr_engine_info(id, &info);
+        printf(" %9s", info.name);
+    }
+    printf("\n");
+
+    for (i = 0; i < NOPS; ++i) {
+        printf("%-15s", ops[i].name);
+        for (id = 0; id < ojr_engine_count(); ++id) {
+            ojr_new(&s, 1);
+            if (0 != ojr_set_engine_r(&s, id)) {
+                printf(" %9s", "-");
+                continue;
+            }
+            t = timed(ops[i].fn, &s, scale * ops[i].count);
+            printf(" %9.2f", 1e9 * t / ((double)scale * ops[i].count));
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+
+    printf("\n%-10s %14s %14s %14s\n", "engine", "MB/s", "shuffles/s",
+        "batched/s");
+    for (id = 0; id < ojr_engine_count(); ++id) {
+        ojr_engine_info(id, &info);
+        if (! info.available) {
+            printf("%-10s %14s %14s %14s\n", info.name, "-", "-", "-");
+            continue;
+        }
+        ojr_new(&s, 1);
+        ojr_set_engine_r(&s, id);
+
+        bps = 8.0 * (double)words / timed(op_next64, &s, words);
+        sps = (double)shuffles / timed(op_shuffle, &s, shuffles);
+        bsps = (double)shuffles / timed(op_batched, &s, shuffles);
+        printf("%-10s %14.1f %14.0f %14.0f\n", info.name, bps / 1e6, sps,
+            bsps);
+        fflush(stdout);
+    }
+    return 0;
+}
+
+/* Chi-square statistic of <cells> counts against one expected value, and
+ * its upper tail probability as <scale> times chi-square with <df> degrees
+ * of freedom, by the Wilson-Hilferty cube root approximation, which is
+ * very good for df in the thousands.
+ */
+static double chisq(const long *obs, int cells, double expect, double scale,
+    double df, double *p) {
+    double x = 0.0, d, z, v = 2.0 / (9.0 * df);
+
+    for (int i = 0; i < cells; ++i) {
+        d = (double)obs[i] - expect;
+        x += d * d / expect;
+    }
+    z = (cbrt(x / scale / df) - (1.0 - v)) / sqrt(v);
+    *p = 0.5 * erfc(z / sqrt(2.0));
+    return x;
+}
+
+static long pos[52][52], pairs[52][52];
+
+static void tally(void) {
+    for (int i = 0; i < 52; ++i) {
+        pos[i][OJL_GET(&deck, i) - 1] += 1;
+        if (i) pairs[OJL_GET(&deck, i - 1) - 1][OJL_GET(&deck, i) - 1] += 1;
+    }
+}
+
+/* Positions: each card equally likely in each position, 52 x 52 cells.
+ * Pairs: each ordered pair of different cards equally likely to be next
+ * to each other, 52 x 51 cells; the diagonal must stay empty.
+ *
+ * A deck isn't independent draws into the cells: it puts exactly one card
+ * in each position, and each card next to at most two others. So neither
+ * statistic is plain chi-square. From the covariance of the cells under a
+ * fair shuffle, the sum and sum of squares of the weights of the
+ * chi-square terms are 52 x 51 and 52^2 for positions, 51^2 and 2651 for
+ * pairs; we use the scaled chi-square with the same mean and variance.
+ * Positions come out exactly 52/51 times chi-square with 51^2 df.
+ */
+static int report(const char *engine, const char *method, long count) {
+    static long off[52 * 51];
+    double x1, x2, p1, p2;
+    int i, j, c = 0, bad = 0;
+
+    for (i = 0; i < 52; ++i) {
+        for (j = 0; j < 52; ++j) {
+            if (i != j) off[c++] = pairs[i][j];
+            else if (pairs[i][j]) bad = 1;
+        }
+    }
+    x1 = chisq(pos[0], 52 * 52, count / 52.0, 52.0 / 51.0, 51.0 * 51.0, &p1);
+    x2 = chisq(off, 52 * 51, count / 52.0, 2651.0 / 2601.0,
+        2601.0 * 2601.0 / 2651.0, &p2);
+
+    if (p1 < 1e-5 || p1 > 1 - 1e-5 || p2 < 1e-5 || p2 > 1 - 1e-5) bad = 1;
+    printf("%-9s %-14s positions %9.1f p = %6.4f   pairs %9.1f p = %6.4f%s\n",
+        engine, method, x1, p1, x2, p2, bad ? "  FAIL" : "");
+    fflush(stdout);
+    return bad;
+}
+
+static int quality(long count) {
+    int id, m, failed = 0;
+    oj_rng_engine_info info;
+    ojr_state s;
+    static const char *methods[] = {
+        "shuffle", "batched", "fill", "fill batched", "fill at index"
+    };
+
+    for (id = 0; id < ojr_engine_count(); ++id) {
+        ojr_engine_info(id, &info);
+        if (! info.available) continue;
+
+        for (m = 0; m < 5; ++m) {
+            // Random access doesn't use the engine; test it once.
+            if (4 == m && id) continue;
+
+            ojr_new(&s, 0);
+            ojr_set_engine_r(&s, id);
+            memset(pos, 0, sizeof(pos));
+            memset(pairs, 0, sizeof(pairs));
+            ojl_fill(&deck, 52, OJD_STANDARD);
+
+            for (long i = 0; i < count; ++i) {
+                switch (m) {
+                case 0: ojl_shuffle_r(&deck, &s); break;
+                case 1: ojl_shuffle_batched_r(&deck, &s); break;
+                case 2: ojl_fill_shuffled_r(&deck, OJD_STANDARD, &s); break;
+                case 3: ojl_fill_shuffled_batched_r(&deck, OJD_STANDARD, &s);
+                    break;
+                case 4: ojl_fill_shuffled_at(&deck, OJD_STANDARD, 0xC0FFEE,
+                    (uint64_t)i); break;
+                }
+                tally();
+            }
+            failed |= report(4 == m ? "philox" : info.name, methods[m], count);
+        }
+    }
+    return failed;
+}
+
+static int stream(const char *name) {
+    int id;
+    uint64_t buf[512];
+    oj_rng_engine_info info;
+    ojr_state s;
+
+    for (id = 0; id < ojr_engine_count(); ++id) {
+        ojr_engine_info(id, &info);
+        if (0 == strcmp(name, info.name)) break;
+    }
+    ojr_new(&s, 0);
+    if (id == ojr_engine_count() || 0 != ojr_set_engine_r(&s, id)) {
+        fprintf(stderr, "No engine \"%s\".\n", name);
+        return 1;
+    }
+    while (1) {
+        for (int i = 0; i < 512; ++i) buf[i] = ojr_next64_r(&s);
+        if (write(STDOUT_FILENO, buf, sizeof(buf)) < 0) return 0;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    long n;
+
+    ojl_new(&deck, dbuf, 52);
+    ojl_new(&hand, hbuf, 7);
+    ojl_fill(&deck, 52, OJD_STANDARD);
+
+    if (argc > 1 && 0 == strcmp("-s", argv[1])) {
+        if (argc < 3) {
+            fprintf(stderr, "Usage: %s -s engine\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+        return stream(argv[2]) ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+    if (argc > 1 && 0 == strcmp("-q", argv[1])) {
+        n = (argc > 2) ? atol(argv[2]) : 200000;
+        if (n < 1000) n = 1000;
+        return quality(n) ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+    n = (argc > 1) ? atol(argv[1]) : 1;
+    return speed(n < 1 ? 1 : (int)n) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -357,6 +357,60 @@ int t_fill(void) {
     return 0;
 }
 
+// Deck orders and ordered hands rank and unrank back to themselves.
+int t_perm(void) {
+    int i, k;
+    oj_uint256 r, r2;
+    oj_card buf[54];
+    oj_cardlist copy;
+    unsigned char packed[OJL_PACKED_SIZE];
+
+    ojl_new(&copy, buf, 54);
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojl_shuffle(&deck);
+    ojl_copy(&copy, &deck);
+    if (0 != ojl_perm_rank(&deck, &r)) return 1;
+    ojl_sort(&copy);
+    if (0 != ojl_perm_unrank(&copy, &r)) return 2;
+    if (! ojl_equal(&copy, &deck)) return 3;
+
+    if (0 != ojl_pack(&deck, packed)) return 4;
+    if (0 != ojl_unpack(&copy, packed)) return 5;
+    if (! ojl_equal(&copy, &deck)) return 6;
+
+    // Sorted order is rank 0.
+    ojl_sort(&copy);
+    ojl_perm_rank(&copy, &r2);
+    if (r2.w[0] | r2.w[1] | r2.w[2] | r2.w[3]) return 7;
+
+#ifdef OJ_HAVE_INT128
+    oj_uint128 q, q2, f = 1;
+    k = 1 + ojr_rand(34);
+    ojl_truncate(&deck, k);
+    ojl_copy(&copy, &deck);
+    ojl_perm_rank128(&deck, &q);
+    ojl_perm_rank(&deck, &r);
+    q2 = ((oj_uint128)r.w[1] << 64) | r.w[0];
+    if (q != q2 || r.w[2] || r.w[3]) return 8;
+    ojl_reverse(&copy);
+    ojl_perm_unrank128(&copy, q);
+    if (! ojl_equal(&copy, &deck)) return 9;
+    for (i = 2; i <= k; ++i) f *= i;
+    if (OJE_BADINDEX != ojl_perm_unrank128(&copy, f)) return 10;
+#endif
+
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojl_shuffle(&deck);
+    k = ojr_rand(21);
+    ojl_clear(&hand20);
+    for (i = 0; i < k; ++i) ojl_append(&hand20, deck.cards[i]);
+    ojl_shuffle(&deck);
+    ojl_kperm_rank(&deck, &hand20, &r);
+    if (0 != ojl_kperm_unrank(&deck, ojl_size(&hand20), &r, &copy)) return 11;
+    if (! ojl_equal(&copy, &hand20)) return 12;
+    return 0;
+}
+
 int fuzz(int count) {
     for (int i = 0; i < count; ++i) {
         int c = ojr_rand(14) + 1;
@@ -424,6 +478,12 @@ int main(int argc, char *argv[]) {
     }
     failed |= r;
 
+    for (int i = 0; i < 100000 && 0 == r; ++i) r = t_perm();
+    if (r) {
+        fprintf(stderr, "Permutation test #%d failed.\n", r);
+    }
+    failed |= r;
+
     fprintf(stderr, "Card list fuzz test ");
     if (failed) {
         fprintf(stderr, "failed. Code = %d", failed);
@@ -96,6 +96,522 @@ int loop_combinations(void) {
     return 0;
 }
 
+uint64_t hand_mask(oj_cardlist *p) {
+    uint64_t m = 0ull;
+    for (int i = 0; i < p->length; ++i) m |= 1ull << p->cards[i];
+    return m;
+}
+
+// Each step must swap exactly one card and count up in rank.
+int test_revdoor(int n, int k) {
+    int64_t c = 0LL;
+    uint64_t m, pm = 0ull;
+
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojl_shuffle(&deck);
+    ojl_truncate(&deck, n);
+    ojc_new_revdoor(&iter1, &deck, &hand1, k, 0LL);
+
+    while (ojc_next(&iter1)) {
+        m = hand_mask(&hand1);
+        if (k != __builtin_popcountll(m)) return 1;
+        if (c) {
+            if ((pm & ~m) != (1ull << iter1.out)) return 2;
+            if ((m & ~pm) != (1ull << iter1.in)) return 3;
+            if (hand1.cards[iter1.slot] != iter1.in) return 4;
+        }
+        if (c != ojc_revdoor_rank(&iter1, &hand1)) return 5;
+        ojc_revdoor_hand_at(&iter1, c, &hand2);
+        if (m != hand_mask(&hand2)) return 6;
+        pm = m;
+        ++c;
+    }
+    if (c != iter1.total) return 7;
+    return 0;
+}
+
+int loop_revdoor(void) {
+    int i, r;
+
+    for (i = 0; i < 8; ++i) {
+        r = test_revdoor(nvals[i], kvals[i]);
+        if (0 != r) return r;
+
+        r = test_revdoor(10 + ojr_rand(10), 1 + ojr_rand(6));
+        if (0 != r) return r;
+    }
+    return 0;
+}
+
+// Pieces of the full range must line up with a plain enumeration.
+int test_ranges(int n, int k, int nchunks) {
+    int64_t f, l, c = 0LL;
+
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojl_shuffle(&deck);
+    ojl_truncate(&deck, n);
+    ojc_new(&iter2, &deck, &hand2, k, 0LL);
+
+    for (int i = 0; i < nchunks; ++i) {
+        if (0 != ojc_chunk(iter2.total, nchunks, i, &f, &l)) return 1;
+        if (f != c || l < f || l - f > iter2.total / nchunks + 1) return 2;
+        if (0 != ojc_new_range(&iter1, &deck, &hand1, k, f, l)) return 3;
+
+        while (ojc_next(&iter1)) {
+            if (! ojc_next(&iter2)) return 4;
+            if (! ojl_equal(&hand1, &hand2)) return 5;
+            if (++c != iter1.rank) return 6;
+        }
+        if (c != l) return 7;
+    }
+    if (c != iter2.total || ojc_next(&iter2)) return 8;
+    if (OJE_BADINDEX != ojc_new_range(&iter1, &deck, &hand1, k, 0LL,
+        iter2.total + 1)) return 9;
+    return 0;
+}
+
+int loop_ranges(void) {
+    int i, r;
+
+    for (i = 0; i < 8; ++i) {
+        r = test_ranges(nvals[i], kvals[i], 1 + ojr_rand(100));
+        if (0 != r) return r;
+    }
+    return test_ranges(10, 3, 200);
+}
+
+// Blocks of random size must match one-at-a-time enumeration.
+int test_blocks(int n, int k) {
+    int i, got, want;
+    int64_t first, ranks[100];
+    oj_card *bp, buf[100 * 16], back[100 * 16];
+
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojl_shuffle(&deck);
+    ojl_truncate(&deck, n);
+    ojc_new(&iter1, &deck, &hand1, k, 0LL);
+    ojc_new(&iter2, &deck, &hand2, k, 0LL);
+
+    while (iter1.remaining) {
+        want = 1 + ojr_rand(100);
+        first = iter1.rank;
+        got = ojc_next_block(&iter1, buf, want);
+        if (got != want && 0 != iter1.remaining) return 1;
+
+        // Batch ranks are the enumeration positions, and map back.
+        ojc_colex_rank_many(&iter1, buf, got, ranks);
+        for (i = 0; i < got; ++i) if (ranks[i] != first + i) return 8;
+        if (0 != ojc_colex_hand_at_many(&iter1, ranks, got, back)) return 9;
+        if (0 != memcmp(buf, back, got * k * sizeof(oj_card))) return 10;
+
+        for (bp = buf; got--; bp += k) {
+            if (! ojc_next(&iter2)) return 2;
+            if (0 != memcmp(bp, hand2.cards, k * sizeof(oj_card))) return 3;
+        }
+        if (! ojl_equal(&hand1, &hand2)) return 4;
+        if (iter1.rank != iter2.rank) return 5;
+
+        // Mixing single steps with blocks has to work too.
+        if (0 == ojr_rand(4) && ojc_next(&iter1)) {
+            ojc_next(&iter2);
+            if (! ojl_equal(&hand1, &hand2)) return 6;
+        }
+    }
+    if (ojc_next(&iter2) || 0 != ojc_next_block(&iter1, buf, 10)) return 7;
+    return 0;
+}
+
+int loop_blocks(void) {
+    int i, r;
+
+    for (i = 0; i < 8; ++i) {
+        r = test_blocks(nvals[i], kvals[i]);
+        if (0 != r) return r;
+
+        r = test_blocks(10 + ojr_rand(20), 1 + ojr_rand(8));
+        if (0 != r) return r;
+    }
+    return 0;
+}
+
+/* Multiset combiner over a small shoe with uneven numbers of copies.
+ * Dealing every position-combination from the shoe and tallying which
+ * multiset each one lands on must reproduce the weights exactly.
+ */
+oj_multiset mset;
+int64_t tally[50000];
+
+int test_multiset(int ntypes, int k) {
+    int i, j, m;
+    int64_t r, sum = 0, c = 0;
+    oj_card sbuf[54];
+    oj_cardlist shoe;
+
+    ojl_new(&shoe, sbuf, 54);
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojl_shuffle(&deck);
+    for (i = 0; i < ntypes; ++i) {
+        m = 1 + ojr_rand(4);
+        for (j = 0; j < m && shoe.length < 54; ++j) {
+            OJL_APPEND(&shoe, deck.cards[i]);
+        }
+    }
+    ojl_shuffle(&shoe);
+    if (shoe.length < k) return 0;
+
+    if (0 != ojc_multiset_new(&mset, &shoe, &hand1, k, 0LL)) return 1;
+    if (mset.total > 50000) return 2;
+    memset(tally, 0, sizeof(tally));
+
+    ojc_new(&iter1, &shoe, &hand2, k, 0LL);
+    while (ojc_next(&iter1)) {
+        r = ojc_multiset_rank(&mset, &hand2);
+        if (r < 0 || r >= mset.total) return 3;
+        ++tally[r];
+    }
+    while (ojc_multiset_next(&mset)) {
+        if (mset.rank - 1 != c) return 4;
+        if (ojc_multiset_rank(&mset, &hand1) != c) return 5;
+        ojc_multiset_hand_at(&mset, c, &hand2);
+        if (! ojl_equal(&hand1, &hand2)) return 6;
+        if (tally[c] != mset.weight) return 7;
+        sum += mset.weight;
+        ++c;
+    }
+    if (c != mset.total) return 8;
+    if (sum != ojc_binomial(shoe.length, k)) return 9;
+    return 0;
+}
+
+int loop_multiset(void) {
+    int i, r;
+    oj_card sbuf[1000], bbuf[32];
+    oj_cardlist shoe, big;
+
+    for (i = 0; i < 12; ++i) {
+        r = test_multiset(3 + ojr_rand(10), 1 + ojr_rand(6));
+        if (0 != r) return r;
+    }
+    // Six-deck shoe: count the 3-card multisets, and rank some 16-card ones.
+    ojl_new(&shoe, sbuf, 312);
+    ojl_fill(&shoe, 312, OJD_STANDARD);
+    if (0 != ojc_multiset_new(&mset, &shoe, &hand1, 3, 0LL)) return 10;
+    if (mset.total != 52 * 51 * 50 / 6 + 52 * 51 + 52) return 11;
+    ojc_multiset_new(&mset, &shoe, &hand1, 16, 0LL);
+    for (r = 0; r < 1000; ++r) {
+        if (! ojc_multiset_next(&mset)) return 12;
+        if (ojc_multiset_rank(&mset, &hand1) != r) return 13;
+    }
+    // 50 copies each of 20 cards: few enough 32-card multisets to count,
+    // but some can be dealt in about 10^50 ways.
+    ojl_new(&shoe, sbuf, 1000);
+    for (i = 0; i < 1000; ++i) OJL_APPEND(&shoe, 1 + i % 20);
+    ojl_new(&big, bbuf, 32);
+    if (OJE_FULL != ojc_multiset_new(&mset, &shoe, &big, 32, 0LL)) return 14;
+    if (0 != ojc_multiset_new(&mset, &shoe, &big, 6, 0LL)) return 15;
+    return 0;
+}
+
+#ifdef OJ_HAVE_INT128
+/* 128-bit binomials agree with the 64-bit ones and with Pascal's rule,
+ * and ranks of big hands from a 6-deck shoe map back to the same cards.
+ */
+int test_big(void) {
+    int i, j, k, n, pos[40], back[40];
+    oj_int128 r, a, b, c;
+
+    for (n = 0; n < 64; ++n) {
+        for (k = 0; k <= n; ++k) {
+            if (ojc_binomial128(n, k) != ojc_binomial(n, k)) return 1;
+        }
+    }
+    for (n = 1; n < 700; ++n) {
+        for (k = 1; k <= n && k < 40; ++k) {
+            a = ojc_binomial128(n - 1, k - 1);
+            b = ojc_binomial128(n - 1, k);
+            c = ojc_binomial128(n, k);
+            if (a < 0 || b < 0) continue;
+            if (a > OJ_INT128_MAX - b) {
+                if (-1 != c) return 2;
+            } else if (c != a + b) return 2;
+        }
+    }
+    for (i = 0; i < 10000; ++i) {
+        n = 312;
+        k = 1 + ojr_rand(26); // C(312, k) fits for k <= 26
+        for (j = 0; j < k; ++j) pos[j] = -1;
+        for (j = 0; j < k; ++j) {
+            // Random ascending positions: pick k distinct, then sort.
+            int x, d;
+            do {
+                x = ojr_rand(n);
+                for (d = 0; d < j && pos[d] != x; ++d) ;
+            } while (d < j);
+            pos[j] = x;
+        }
+        for (j = 1; j < k; ++j) {
+            int x = pos[j], d = j;
+            while (d > 0 && pos[d-1] > x) { pos[d] = pos[d-1]; --d; }
+            pos[d] = x;
+        }
+        r = ojc_colex_rank128(pos, k);
+        if (r < 0 || r >= ojc_binomial128(n, k)) return 3;
+        if (0 != ojc_colex_at128(r, n, k, back)) return 4;
+        if (0 != memcmp(pos, back, k * sizeof(int))) return 5;
+    }
+    // Ranks agree with the 64-bit colex ranks for a standard deck.
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojc_new(&iter1, &deck, &hand1, 5, 0LL);
+    for (i = 0; i < 1000 && ojc_next(&iter1); ++i) {
+        for (j = 0; j < 5; ++j) pos[j] = iter1.map[j];
+        if (ojc_colex_rank128(pos, 5) != iter1.rank - 1) return 6;
+    }
+    if (ojc_colex_at128(ojc_binomial128(312, 20), 312, 20, back) != OJE_BADINDEX) {
+        return 7;
+    }
+    return 0;
+}
+#endif
+
+/* Samplers never repeat a rank, stratified samples land one per stratum,
+ * and the hands are the ones at those ranks.
+ */
+oj_sampler samp;
+unsigned char seen[200000];
+
+int test_sampler(int n, int k, int mode, int64_t count) {
+    int64_t r, c = 0, size;
+
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojl_shuffle(&deck);
+    ojl_truncate(&deck, n);
+    ojc_new(&iter1, &deck, &hand1, k, 0LL);
+    if (iter1.total > 200000) return 1;
+    if (0 != ojc_sampler_new(&samp, &iter1, mode, count)) return 2;
+    if (0 == count) count = iter1.total;
+    memset(seen, 0, sizeof(seen));
+
+    while (ojc_sampler_next(&samp)) {
+        r = ojc_colex_rank(&iter1, &hand1);
+        if (r != ojc_sampler_rank_at(&samp, c)) return 3;
+        if (r < 0 || r >= iter1.total) return 4;
+        if (seen[r]++) return 5;
+
+        if (OJC_SAMPLE_STRATIFIED == mode) {
+            size = iter1.total / count;
+            if (r < c * size || r > (c + 1) * size + c) return 6;
+        }
+        ++c;
+    }
+    if (c != count) return 7;
+    return 0;
+}
+
+int loop_sampler(void) {
+    int i, r, m;
+
+    for (i = 0; i < 8; ++i) {
+        for (m = OJC_SAMPLE_PERMUTE; m <= OJC_SAMPLE_LATTICE; ++m) {
+            if (0 != (r = test_sampler(nvals[i], kvals[i], m, 0))) return r;
+            if (0 != (r = test_sampler(nvals[i], kvals[i], m, 1))) return r;
+            r = test_sampler(nvals[i], kvals[i], m,
+                1 + (int64_t)ojr_rand64(tvals[i]));
+            if (0 != r) return r;
+        }
+    }
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojc_new(&iter1, &deck, &hand1, 5, 0LL);
+    if (OJE_BADINDEX != ojc_sampler_new(&samp, &iter1, 3, 0)) return 11;
+    if (OJE_BADINDEX != ojc_sampler_new(&samp, &iter1, 0, iter1.total + 1)) {
+        return 12;
+    }
+    return 0;
+}
+
+#ifdef OJ_HAVE_INT128
+/* Dealer: every deal of a small deck comes up once, in rank order, with
+ * disjoint hands; and for big deals ranks and deals map back and forth.
+ */
+oj_dealer dealer;
+oj_card gbuf[4][16], gbuf2[4][16];
+oj_cardlist glist[4], glist2[4];
+oj_cardlist *groups[4] = { &glist[0], &glist[1], &glist[2], &glist[3] };
+oj_cardlist *groups2[4] = { &glist2[0], &glist2[1], &glist2[2], &glist2[3] };
+
+int test_dealer(int n, int ngroups, const int *sizes, int full) {
+    int g, i;
+    uint64_t m;
+    oj_int128 r, c = 0;
+
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojl_shuffle(&deck);
+    ojl_truncate(&deck, n);
+    if (0 != ojc_dealer_new(&dealer, &deck, groups, sizes, ngroups)) return 1;
+
+    while (ojc_dealer_next(&dealer)) {
+        for (m = 0, g = 0; g < ngroups; ++g) {
+            if (glist[g].length != sizes[g]) return 2;
+            for (i = 0; i < sizes[g]; ++i) {
+                if (m & (1ull << glist[g].cards[i])) return 3;
+                m |= 1ull << glist[g].cards[i];
+            }
+        }
+        if (ojc_dealer_rank(&dealer, groups) != c) return 4;
+        ojc_dealer_deal_at(&dealer, c, groups2);
+        for (g = 0; g < ngroups; ++g) {
+            if (! ojl_equal(&glist[g], &glist2[g])) return 5;
+        }
+        ++c;
+        if (! full && c > 100000) break;
+    }
+    if (full && c != dealer.total) return 6;
+
+    for (i = 0; i < 1000; ++i) {
+        r = (oj_int128)((((oj_uint128)ojr_next64() << 64) | ojr_next64()) %
+            (oj_uint128)dealer.total);
+        if (0 != ojc_dealer_deal_at(&dealer, r, groups)) return 7;
+        if (ojc_dealer_rank(&dealer, groups) != r) return 8;
+    }
+    return 0;
+}
+
+int loop_dealer(void) {
+    int i, r;
+    int s1[] = { 2, 2, 3 }, s2[] = { 2, 2, 5 }, s3[] = { 13, 13, 13, 13 };
+    int s4[] = { 6, 6, 6, 6, 6, 6, 6, 6 };
+    oj_int128 e18 = 1000000000000000000ll;
+    oj_int128 bridge = (oj_int128)53644737765ll * e18 + 488792839237440000ll;
+    oj_int128 six6 = (27 * e18 + 671571239987979488ll) * e18 +
+        377266619658112000ll;
+    oj_card b8[8][6];
+    oj_cardlist l8[8], *g8[8];
+
+    for (i = 0; i < 4; ++i) {
+        ojl_new(&glist[i], gbuf[i], 16);
+        ojl_new(&glist2[i], gbuf2[i], 16);
+    }
+    if (0 != (r = test_dealer(10, 3, s1, 1))) return r;
+    if (dealer.total != 25200) return 10;
+    if (0 != (r = test_dealer(9, 2, s1 + 1, 1))) return r;
+    if (0 != (r = test_dealer(52, 3, s2, 0))) return r;
+    if (dealer.total != (oj_int128)1326 * 1225 * 1712304) return 11;
+    if (0 != (r = test_dealer(52, 4, s3, 0))) return r;
+    if (dealer.total != bridge) return 12;
+
+    // Hands are written directly, so can't keep a uniqueness mask.
+    ojl_set_pflag(&glist[1], OJF_UNIQUE);
+    r = ojc_dealer_new(&dealer, &deck, groups, s1, 3);
+    ojl_clear_pflag(&glist[1], OJF_UNIQUE);
+    if (OJE_DUPLICATE != r) return 13;
+
+    // Six hands of six from 52 just fit in 128 bits, seven don't.
+    for (i = 0; i < 8; ++i) {
+        ojl_new(&l8[i], b8[i], 6);
+        g8[i] = &l8[i];
+    }
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    if (0 != ojc_dealer_new(&dealer, &deck, g8, s4, 6)) return 14;
+    if (dealer.total != six6) return 15;
+    if (OJE_FULL != ojc_dealer_new(&dealer, &deck, g8, s4, 7)) return 16;
+    if (OJE_FULL != ojc_dealer_new(&dealer, &deck, g8, s4, 8)) return 17;
+    return 0;
+}
+#endif
+
+/* Seeking lands on the right hand, and a combiner restored from a
+ * checkpoint carries on exactly as the original does.
+ */
+int test_checkpoint(int n, int k, int mode) {
+    int i, steps;
+    int64_t r;
+    oj_card saved[100][8], sbuf[8];
+    oj_cardlist small;
+    unsigned char ck[OJC_CHECKPOINT_SIZE], bad[OJC_CHECKPOINT_SIZE];
+
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojl_shuffle(&deck);
+    ojl_truncate(&deck, n);
+    if (1 == mode) ojc_new_revdoor(&iter1, &deck, &hand1, k, 0LL);
+    else ojc_new(&iter1, &deck, &hand1, k, 0LL);
+
+    if (2 != mode) {
+        r = (int64_t)ojr_rand64(iter1.total);
+        if (0 != ojc_seek(&iter1, r) || ojc_tell(&iter1) != r) return 1;
+        if (! ojc_next(&iter1)) return 2;
+        if (1 == mode) ojc_revdoor_hand_at(&iter1, r, &hand2);
+        else ojc_colex_hand_at(&iter1, r, &hand2);
+        if (! ojl_equal(&hand1, &hand2)) return 3;
+        if (ojc_tell(&iter1) != r + 1) return 4;
+    }
+    // A combiner only becomes a random one, with generator state in its
+    // checkpoints, on its first ojc_next_random(); make sure it has.
+    for (i = ojr_rand(50) + (2 == mode); i > 0; --i) {
+        if (2 == mode) ojc_next_random(&iter1);
+        else ojc_next(&iter1);
+    }
+    if (OJC_CHECKPOINT_SIZE != ojc_checkpoint(&iter1, ck, sizeof(ck))) return 5;
+
+    for (steps = 0; steps < 100; ++steps) {
+        if (2 == mode) {
+            if (! ojc_next_random(&iter1)) break;
+        } else if (! ojc_next(&iter1)) break;
+        memmove(saved[steps], hand1.cards, k * sizeof(oj_card));
+    }
+    ojr_next64(); // Move the generator on; restoring must undo it.
+    if (0 != ojc_restore(&iter2, &deck, &hand2, ck, sizeof(ck))) return 6;
+    for (i = 0; i < steps; ++i) {
+        if (2 == mode) {
+            if (! ojc_next_random(&iter2)) return 7;
+        } else if (! ojc_next(&iter2)) return 7;
+        // Revolving door slots restart in deck order; compare as sets.
+        if (1 == mode) {
+            hand1.length = k;
+            memmove(hand1.cards, saved[i], k * sizeof(oj_card));
+            if (hand_mask(&hand1) != hand_mask(&hand2)) return 8;
+        } else if (0 != memcmp(saved[i], hand2.cards, k * sizeof(oj_card))) {
+            return 8;
+        }
+    }
+    if (iter2.remaining != iter1.remaining) return 9;
+
+    // Bad input is an error, never an abort.
+    ojl_new(&small, sbuf, k - 1);
+    if (OJE_FULL != ojc_restore(&iter2, &deck, &small, ck, sizeof(ck))) {
+        return 10;
+    }
+    ojl_set_pflag(&hand2, OJF_RDONLY);
+    r = ojc_restore(&iter2, &deck, &hand2, ck, sizeof(ck));
+    ojl_clear_pflag(&hand2, OJF_RDONLY);
+    if (OJE_RDONLY != r) return 10;
+    memmove(bad, ck, sizeof(ck));
+    bad[5] = 9;
+    if (OJE_BADINDEX != ojc_restore(&iter2, &deck, &hand2, bad, sizeof(bad))) {
+        return 10;
+    }
+    memmove(bad, ck, sizeof(ck));
+    bad[6] = 60;
+    if (OJE_BADINDEX != ojc_restore(&iter2, &deck, &hand2, bad, sizeof(bad))) {
+        return 10;
+    }
+
+    ojl_truncate(&deck, n - 1);
+    if (OJE_BADINDEX != ojc_restore(&iter2, &deck, &hand2, ck, sizeof(ck))) {
+        return 10;
+    }
+    return 0;
+}
+
+int loop_checkpoint(void) {
+    int i, m, r;
+
+    for (i = 0; i < 8; ++i) {
+        for (m = 0; m < 3; ++m) {
+            if (0 != (r = test_checkpoint(nvals[i], kvals[i], m))) return r;
+        }
+    }
+    return 0;
+}
+
 int test_montecarlo(int n, int k, long long count) {
     int r;
     int64_t t;
@@ -156,6 +672,42 @@ int main(int argc, char *argv[]) {
     failed |= r;
     fprintf(stderr, "Combinations test %sed.\n", (r ? "fail" : "pass"));
 
+    r = loop_revdoor();
+    failed |= r;
+    fprintf(stderr, "Revolving door test %sed.\n", (r ? "fail" : "pass"));
+
+    r = loop_ranges();
+    failed |= r;
+    fprintf(stderr, "Range test %sed.\n", (r ? "fail" : "pass"));
+
+    r = loop_blocks();
+    failed |= r;
+    fprintf(stderr, "Block test %sed.\n", (r ? "fail" : "pass"));
+
+    r = loop_multiset();
+    failed |= r;
+    fprintf(stderr, "Multiset test %sed.\n", (r ? "fail" : "pass"));
+
+#ifdef OJ_HAVE_INT128
+    r = test_big();
+    failed |= r;
+    fprintf(stderr, "128-bit test %sed.\n", (r ? "fail" : "pass"));
+#endif
+
+    r = loop_sampler();
+    failed |= r;
+    fprintf(stderr, "Sampler test %sed.\n", (r ? "fail" : "pass"));
+
+#ifdef OJ_HAVE_INT128
+    r = loop_dealer();
+    failed |= r;
+    fprintf(stderr, "Dealer test %sed.\n", (r ? "fail" : "pass"));
+#endif
+
+    r = loop_checkpoint();
+    failed |= r;
+    fprintf(stderr, "Checkpoint test %sed.\n", (r ? "fail" : "pass"));
+
     r = loop_montecarlo();
     failed |= r;
     fprintf(stderr, "Monte carlo test %sed.\n", (r ? "fail" : "pass"));
@@ -0,0 +1,225 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Test poker hand evaluation functions.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <string.h>
+#include <assert.h>
+
+#include "ojcardlib.h"
+
+oj_cardlist deck, hand;
+oj_card dbuf[52], hbuf[8];
+
+void initialize(void) {
+    ojl_new(&deck, dbuf, 52);
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojl_new(&hand, hbuf, 8);
+}
+
+// Upper bound of each hand group's values, and the number of 7-card hands
+// in each group.
+int gmax[] = { 10, 166, 322, 1599, 1609, 2467, 3325, 6185, 7462 };
+int64_t g7[] = { 41584LL, 224848LL, 3473184LL, 4047644LL, 6180020LL,
+    6461620LL, 31433400LL, 58627800LL, 23294460LL };
+
+int eqclasses(void) {
+    int g, nc;
+    int64_t t, gt[9], c5[OJP_NCLASSES + 1];
+    oj_combiner cmb;
+    oj_poker_eqclass eq;
+
+    memset(c5, 0, sizeof(c5));
+    ojc_new(&cmb, &deck, &hand, 5, 0LL);
+    while (ojc_next(&cmb)) ++c5[ojp_eval5(&hand)];
+
+    nc = 0;
+    t = 0LL;
+    ojp_eqclass_new(&eq, &hand, 5);
+    while (ojp_eqclass_next(&eq)) {
+        ++nc;
+        t += eq.count;
+        if (eq.val != nc) return 1;
+        if (eq.count != c5[eq.val]) return 2;
+        if (eq.val != ojp_eval5(&hand)) return 3;
+    }
+    if (OJP_NCLASSES != nc || 2598960LL != t) return 4;
+
+    nc = 0;
+    t = 0LL;
+    ojp_eqclass_new(&eq, &hand, 6);
+    while (ojp_eqclass_next(&eq)) {
+        ++nc;
+        t += eq.count;
+    }
+    if (6075 != nc || 20358520LL != t) return 5;
+
+    nc = 0;
+    t = 0LL;
+    memset(gt, 0, sizeof(gt));
+    ojp_eqclass_new(&eq, &hand, 7);
+    while (ojp_eqclass_next(&eq)) {
+        ++nc;
+        t += eq.count;
+        for (g = 0; eq.val > gmax[g]; ++g) ;
+        gt[g] += eq.count;
+    }
+    if (4824 != nc || 133784560LL != t) return 6;
+    if (4324LL != ojp_eqclass_count(1, 7)) return 7;
+    for (g = 0; g < 9; ++g) if (gt[g] != g7[g]) return 8;
+    return 0;
+}
+
+int split_evaluator(int count) {
+    oj_combiner cmb;
+
+    ojc_new(&cmb, &deck, &hand, 5, 0LL);
+    while (ojc_next(&cmb)) {
+        if (ojp_eval5(&hand) != ojp_eval5_split(&hand)) return 1;
+    }
+    ojc_new(&cmb, &deck, &hand, 7, (int64_t)count);
+    while (ojc_next_random(&cmb)) {
+        if (ojp_eval7(&hand) != ojp_eval7_split(&hand)) return 2;
+    }
+    // Duplicate cards aren't in the tables, but mustn't crash or disagree.
+    ojc_new(&cmb, &deck, &hand, 7, (int64_t)count / 10);
+    while (ojc_next_random(&cmb)) {
+        hand.length = 7;
+        OJL_SET(&hand, 1, OJL_GET(&hand, 0));
+        OJL_SET(&hand, 6, OJL_GET(&hand, 5));
+        if (ojp_eval7(&hand) != ojp_eval7_split(&hand)) return 3;
+        hand.length = 5;
+        if (ojp_eval5(&hand) != ojp_eval5_split(&hand)) return 4;
+    }
+    return 0;
+}
+
+// Every engine must agree with LDC, one at a time and in batches.
+int engines(int count) {
+    int e, n, v5[100], v7[100], b5[100], b7[100];
+    oj_card h5[500], h7[700];
+    oj_combiner cmb;
+    oj_poker_engine_info info;
+
+    n = ojp_engine_count();
+    if (n < 3) return 1;
+
+    for (e = 0; e < n; ++e) {
+        ojp_set_engine(OJP_ENGINE_LDC);
+        ojc_new(&cmb, &deck, &hand, 5, 100LL);
+        for (int i = 0; ojc_next_random(&cmb); ++i) {
+            memmove(h5 + 5 * i, hbuf, 5 * sizeof(oj_card));
+            v5[i] = ojp_eval5(&hand);
+        }
+        ojc_new(&cmb, &deck, &hand, 7, 100LL);
+        for (int i = 0; ojc_next_random(&cmb); ++i) {
+            memmove(h7 + 7 * i, hbuf, 7 * sizeof(oj_card));
+            v7[i] = ojp_eval7(&hand);
+        }
+        if (0 != ojp_set_engine(e)) {
+            if (OJP_ENGINE_TABLE7 == e) continue; // needs table file
+            return 2;
+        }
+        if (e != ojp_get_engine()) return 3;
+        if (0 != ojp_engine_info(e, &info)) return 4;
+        if (! info.current || info.tablebytes <= 0) return 5;
+
+        if (100 != ojp_eval5_many(h5, 100, b5)) return 6;
+        if (100 != ojp_eval7_many(h7, 100, b7)) return 7;
+        for (int i = 0; i < 100; ++i) {
+            if (b5[i] != v5[i] || b7[i] != v7[i]) return 8;
+        }
+        ojc_new(&cmb, &deck, &hand, 7, (int64_t)count);
+        while (ojc_next_random(&cmb)) {
+            if (ojp_eval7(&hand) != ojp_eval7_split(&hand)) return 9;
+        }
+        ojc_new(&cmb, &deck, &hand, 5, (int64_t)count);
+        while (ojc_next_random(&cmb)) {
+            if (ojp_eval5(&hand) != ojp_eval5_split(&hand)) return 10;
+        }
+    }
+    if (OJE_BADINDEX != ojp_set_engine(n)) return 11;
+    ojp_set_engine(OJP_ENGINE_LDC);
+    return 0;
+}
+
+int colex7(int count) {
+    oj_combiner cmb;
+
+    ojc_new(&cmb, &deck, &hand, 7, (int64_t)count);
+    while (ojc_next_random(&cmb)) {
+        if (ojc_colex_rank(&cmb, &hand) != ojc_colex_rank7(hbuf)) return 1;
+    }
+    return 0;
+}
+
+int masks(int count) {
+    int n, v[3], b[3];
+    uint64_t m[3];
+    oj_card bb[5];
+    oj_cardlist best;
+    oj_combiner cmb;
+
+    ojl_new(&best, bb, 5);
+    for (n = 5; n <= 7; ++n) {
+        ojc_new(&cmb, &deck, &hand, n, (int64_t)count);
+        while (ojc_next_random(&cmb)) {
+            m[n - 5] = 0ull;
+            for (int i = 0; i < n; ++i) m[n - 5] |= 1ull << hbuf[i];
+            v[n - 5] = ojp_best5(&hand, &best);
+
+            if (v[n - 5] != ojp_eval_mask(m[n - 5])) return n;
+        }
+    }
+    if (3 != ojp_eval_mask_many(m, 3, b)) return 10;
+    for (n = 0; n < 3; ++n) if (b[n] != v[n]) return 11;
+
+    ojl_clear(&hand);
+    ojl_set_pflag(&hand, OJF_UNIQUE);
+    ojl_extend_text(&hand, "AsKsQsJsTs9s8s", 0);
+    if (1 != ojp_eval_mask(hand.mask)) return 12;
+    ojl_clear_pflag(&hand, OJF_UNIQUE);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    int r, failed = 0;
+
+    initialize();
+    r = eqclasses();
+    failed |= r;
+    fprintf(stderr, "Equivalence class test %sed.\n", (r ? "fail" : "pass"));
+
+    r = split_evaluator(1000000);
+    failed |= r;
+    fprintf(stderr, "Split evaluator test %sed.\n", (r ? "fail" : "pass"));
+
+    r = colex7(100000);
+    failed |= r;
+    fprintf(stderr, "7-card colex rank test %sed.\n", (r ? "fail" : "pass"));
+
+    r = masks(100000);
+    failed |= r;
+    fprintf(stderr, "Mask evaluator test %sed.\n", (r ? "fail" : "pass"));
+
+    r = engines(100000);
+    failed |= r;
+    fprintf(stderr, "Engine test %sed.\n", (r ? "fail" : "pass"));
+
+    fprintf(stderr, "Poker tests ");
+    if (failed) {
+        fprintf(stderr, "failed. Code: %d\n", failed);
+    } else {
+        fprintf(stderr, "passed.\n");
+    }
+    (void)(argc);
+    (void)(argv); // keep -Wextra happy
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -7,9 +7,13 @@
  * Tests for pseudo-random number generator.
  */
 
+#define _POSIX_C_SOURCE 200112L
+
 #include <stdlib.h>
 #include <stdio.h>
 #include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 #include <string.h>
 #include <assert.h>
 #include <stdint.h>
@@ -86,6 +90,432 @@ int seed_test(void) {
     return 0;
 }
 
+/* Separate generator states don't disturb each other or the default: two
+ * states seeded alike give the same output however calls are interleaved.
+ */
+int state_test(void) {
+    int i;
+    uint32_t a[1000], b[1000];
+    ojr_state s1, s2;
+    oj_card buf1[52], buf2[52];
+    oj_cardlist d1, d2;
+
+    ojr_new(&s1, 0x2468ACE0);
+    for (i = 0; i < 1000; ++i) a[i] = ojr_next32_r(&s1);
+
+    ojr_new(&s1, 0x2468ACE0);
+    ojr_new(&s2, 0x2468ACE0);
+    ojr_seed(0x2468ACE0);
+    for (i = 0; i < 1000; ++i) {
+        b[i] = ojr_next32_r(&s2);
+        ojr_next16_r(&s1);
+        ojr_next64();
+    }
+    if (! allequal(a, b, 1000)) return 1;
+
+    ojr_new(&s1, 77);
+    ojr_new(&s2, 77);
+    ojl_new(&d1, buf1, 52);
+    ojl_new(&d2, buf2, 52);
+    for (i = 0; i < 1000; ++i) {
+        ojl_fill_shuffled_r(&d1, OJD_STANDARD, &s1);
+        ojr_next32();
+        ojl_fill_shuffled_r(&d2, OJD_STANDARD, &s2);
+        if (! ojl_equal(&d1, &d2)) return 2;
+    }
+    return 0;
+}
+
+/* Jumping ahead lands exactly where stepping does, jumps add, and
+ * streams are reproducible and distinct.
+ */
+int same_state(ojr_state *a, ojr_state *b) {
+    return a->x == b->x && a->y == b->y && a->z1 == b->z1 &&
+        a->c1 == b->c1 && a->z2 == b->z2 && a->c2 == b->c2;
+}
+
+int jump_test(void) {
+    int i, j, m;
+    uint64_t n1, n2;
+    uint32_t a[100], b[100];
+    ojr_state s1, s2, s3;
+
+    for (i = 0; i < 20; ++i) {
+        // Each full ring is OJR_RING_WORDS steps.
+        m = 1 + ojr_rand(50);
+        ojr_new(&s1, 0x13579BDF + i);
+        ojr_new(&s2, 0x13579BDF + i);
+        for (j = 0; j < 4 * m * OJR_RING_WORDS; ++j) ojr_next16_r(&s1);
+        ojr_jump_r(&s2, (uint64_t)m * OJR_RING_WORDS);
+        if (! same_state(&s1, &s2)) return 1;
+
+        for (j = 0; j < 100; ++j) a[j] = ojr_next32_r(&s1);
+        for (j = 0; j < 100; ++j) b[j] = ojr_next32_r(&s2);
+        if (! allequal(a, b, 100)) return 2;
+
+        n1 = ojr_next64();
+        n2 = ojr_next64();
+        ojr_new(&s1, 0x2468ACE + i);
+        ojr_new(&s2, 0x2468ACE + i);
+        ojr_jump_r(&s1, n1);
+        ojr_jump_r(&s1, n2);
+        ojr_jump_r(&s2, n2);
+        ojr_jump_r(&s2, n1);
+        if (! same_state(&s1, &s2)) return 3;
+    }
+    // Two jumps of 2^63 make one stream.
+    ojr_seed_stream_r(&s1, 987654, 1);
+    ojr_new(&s2, 987654);
+    ojr_jump_r(&s2, 1ull << 63);
+    ojr_jump_r(&s2, 1ull << 63);
+    if (! same_state(&s1, &s2)) return 4;
+
+    ojr_seed_stream_r(&s2, 987654, 0);
+    ojr_new(&s3, 987654);
+    if (! same_state(&s2, &s3)) return 5;
+    ojr_seed_stream_r(&s3, 987654, 1);
+    if (! same_state(&s1, &s3)) return 6;
+    ojr_seed_stream_r(&s3, 987654, 2);
+    for (j = 0; j < 100; ++j) a[j] = ojr_next32_r(&s1);
+    for (j = 0; j < 100; ++j) b[j] = ojr_next32_r(&s3);
+    for (j = 0; j < 100; ++j) if (a[j] == b[j]) return 7;
+    return 0;
+}
+
+/* JKISS4 lane k produces the same words as scalar JKISS jumped k * 2^62,
+ * interleaved four at a time.
+ */
+int engine_test(void) {
+    int i, j, k;
+    uint64_t w[4][OJR_RING_WORDS];
+    ojr_state s4, sc;
+
+    for (i = 0; i < 4; ++i) {
+        ojr_new(&s4, 1000 + i);
+        if (ojr_set_engine_r(&s4, OJR_ENGINE_JKISS4) < 0) return 1;
+        if (OJR_ENGINE_JKISS4 != ojr_get_engine_r(&s4)) return 2;
+        if (i & 1) ojr_jump_r(&s4, 12345);
+
+        for (k = 0; k < 4; ++k) {
+            ojr_new(&sc, 1000 + i);
+            ojr_jump_r(&sc, (uint64_t)k << 62);
+            if (i & 1) ojr_jump_r(&sc, 12345);
+            for (j = 0; j < OJR_RING_WORDS; ++j) {
+                w[k][OJR_RING_WORDS - 1 - j] = ojr_next64_r(&sc);
+            }
+        }
+        for (j = OJR_RING_WORDS - 1; j >= 0; --j) {
+            if (ojr_next64_r(&s4) != w[j & 3][j >> 2]) return 3;
+        }
+        // Reseeding keeps the engine.
+        ojr_seed_r(&s4, 1000 + i);
+        if (i & 1) ojr_jump_r(&s4, 12345);
+        if (ojr_next64_r(&s4) != w[3][(OJR_RING_WORDS >> 2) - 1]) return 4;
+    }
+    if (OJE_BADINDEX != ojr_set_engine_r(&s4, 99)) return 5;
+
+    // So does reseeding the default state.
+    ojr_new(&sc, 1234);
+    ojr_set_engine_r(&sc, OJR_ENGINE_XOSHIRO);
+    ojr_set_engine(OJR_ENGINE_XOSHIRO);
+    ojr_seed(1234);
+    if (OJR_ENGINE_XOSHIRO != ojr_get_engine()) return 6;
+    for (j = 0; j < 1000; ++j) if (ojr_next64() != ojr_next64_r(&sc)) return 7;
+    ojr_set_engine(OJR_ENGINE_JKISS);
+    return 0;
+}
+
+/* Every engine is reproducible from a seed, keeps to itself when reseeded
+ * or split into streams, jumps to where stepping would take it, and gives
+ * about as many one bits as zeros.
+ */
+int backend_test(void) {
+    int i, j, id, w;
+    long ones;
+    uint64_t a[OJR_RING_WORDS];
+    oj_rng_engine_info info;
+    ojr_state s1, s2;
+
+    for (id = 0; id < ojr_engine_count(); ++id) {
+        ojr_engine_info(id, &info);
+        if (! info.available) continue;
+        // JKISS4 jumps are per lane.
+        w = (OJR_ENGINE_JKISS4 == id) ? 4 : 1;
+
+        ojr_new(&s1, 2468);
+        ojr_new(&s2, 2468);
+        if (0 != ojr_set_engine_r(&s1, id)) return 1;
+        if (0 != ojr_set_engine_r(&s2, id)) return 1;
+        for (j = 0; j < 1000; ++j) {
+            if (ojr_next64_r(&s1) != ojr_next64_r(&s2)) return 2;
+        }
+        ojr_seed_r(&s1, 1357);
+        ojr_seed_stream_r(&s2, 1357, 0);
+        if (id != ojr_get_engine_r(&s2)) return 3;
+        for (j = 0; j < 1000; ++j) {
+            if (ojr_next64_r(&s1) != ojr_next64_r(&s2)) return 3;
+        }
+        ojr_seed_stream_r(&s2, 1357, 1);
+        for (j = 0; j < 1000; ++j) {
+            if (ojr_next64_r(&s1) == ojr_next64_r(&s2)) return 4;
+        }
+        // Stepping three ring buffers is a jump of 3 * OJR_RING_WORDS.
+        ojr_seed_r(&s1, 97531);
+        ojr_seed_r(&s2, 97531);
+        for (j = 0; j < 3 * OJR_RING_WORDS; ++j) ojr_next64_r(&s1);
+        ojr_jump_r(&s2, 3 * OJR_RING_WORDS / w);
+        for (j = 0; j < OJR_RING_WORDS; ++j) {
+            if (ojr_next64_r(&s1) != ojr_next64_r(&s2)) return 5;
+        }
+        // Jumps add.
+        ojr_seed_r(&s1, 86420);
+        ojr_seed_r(&s2, 86420);
+        ojr_jump_r(&s1, 1ull << 40);
+        ojr_jump_r(&s1, (1ull << 41) + 8);
+        ojr_jump_r(&s2, (3ull << 40) + 8);
+        for (j = 0; j < 100; ++j) {
+            if (ojr_next64_r(&s1) != ojr_next64_r(&s2)) return 6;
+        }
+        ones = 0;
+        for (j = 0; j < 100000; ++j) {
+            ones += __builtin_popcountll(ojr_next64_r(&s1));
+        }
+        if (labs(ones - 3200000) > 8000) return 7;
+    }
+    // Engines differ from each other. The first JKISS4 lane starts where
+    // JKISS does, so those two share one word.
+    for (id = 0; id < ojr_engine_count(); ++id) {
+        ojr_new(&s1, 2468);
+        if (0 != ojr_set_engine_r(&s1, id)) continue;
+        for (j = 0; j < OJR_RING_WORDS; ++j) a[j] = ojr_next64_r(&s1);
+
+        for (i = id + 1; i < ojr_engine_count(); ++i) {
+            ojr_new(&s2, 2468);
+            if (0 != ojr_set_engine_r(&s2, i)) continue;
+            for (w = j = 0; j < OJR_RING_WORDS; ++j) {
+                if (a[j] == ojr_next64_r(&s2)) ++w;
+            }
+            if (w > 1) return 8;
+        }
+    }
+    if (OJE_BADINDEX != ojr_engine_info(-1, &info)) return 9;
+    return 0;
+}
+
+static void put_le(unsigned char *p, uint64_t v, int n) {
+    for (int i = 0; i < n; ++i, v >>= 8) p[i] = (unsigned char)v;
+}
+
+// A saved state for <engine> with engine words <w> of <wsize> bytes each.
+static void make_state(unsigned char *buf, int engine, const uint64_t *w,
+    int n, int wsize) {
+    memset(buf, 0, OJR_STATE_SIZE);
+    memcpy(buf, "OJRS", 4);
+    buf[4] = 1;
+    buf[5] = engine;
+    put_le(buf + 8, 1, 8);
+    put_le(buf + 16, 1, 8);
+    for (int i = 0; i < n; ++i) put_le(buf + 40 + wsize * i, w[i], wsize);
+}
+
+/* Saved states give back the same output on any state, whatever the
+ * engine and however far into the ring buffer we were; saved states set
+ * by hand reproduce the published test vectors; seeding from bytes uses
+ * all of them.
+ */
+int save_test(void) {
+    int i, j, id;
+    uint32_t a[512], b[512];
+    unsigned char ck[OJR_STATE_SIZE], ck2[OJR_STATE_SIZE];
+    oj_rng_engine_info info;
+    ojr_state s1, s2;
+    uint64_t xo[4] = { 1, 2, 3, 4 };
+    uint64_t pcg[4] = { 0xD3F6C45A41E54320ull, 0xDE2BCE05BE013BE3ull, 109, 0 };
+    uint64_t cc[12] = { 0x03020100, 0x07060504, 0x0B0A0908, 0x0F0E0D0C,
+        0x13121110, 0x17161514, 0x1B1A1918, 0x1F1E1D1C,
+        1, 0x09000000, 0x4A000000, 0 };
+
+    for (id = 0; id < ojr_engine_count(); ++id) {
+        ojr_engine_info(id, &info);
+        if (! info.available) continue;
+
+        for (i = 0; i < 20; ++i) {
+            ojr_new(&s1, 5000 + i);
+            ojr_set_engine_r(&s1, id);
+            for (j = ojr_rand(3000); j > 0; --j) ojr_next16_r(&s1);
+
+            if (OJR_STATE_SIZE != ojr_get_state_r(&s1, ck, sizeof(ck))) return 1;
+            for (j = 0; j < 512; ++j) a[j] = ojr_next32_r(&s1);
+
+            memset(&s2, 0xA5, sizeof(s2));
+            if (0 != ojr_set_state_r(&s2, ck, sizeof(ck))) return 2;
+            if (id != ojr_get_engine_r(&s2)) return 2;
+            for (j = 0; j < 512; ++j) b[j] = ojr_next32_r(&s2);
+            if (! allequal(a, b, 512)) return 3;
+
+            // Set back on itself, and saved again from there.
+            ojr_set_state_r(&s1, ck, sizeof(ck));
+            ojr_get_state_r(&s1, ck2, sizeof(ck2));
+            if (0 != memcmp(ck, ck2, OJR_STATE_SIZE)) return 4;
+            for (j = 0; j < 512; ++j) b[j] = ojr_next32_r(&s1);
+            if (! allequal(a, b, 512)) return 4;
+        }
+    }
+    if (OJE_FULL != ojr_get_state_r(&s1, ck, OJR_STATE_SIZE - 1)) return 5;
+    ck[0] = 'X';
+    if (OJE_BADINDEX != ojr_set_state_r(&s1, ck, sizeof(ck))) return 6;
+
+    // First words of xoshiro256** from { 1, 2, 3, 4 }, of PCG64 seeded
+    // with (42, 54), and of ChaCha20 block 1 in RFC 8439 section 2.3.2.
+    // The ring is read from the top down, so these come out last.
+    make_state(ck, OJR_ENGINE_XOSHIRO, xo, 4, 8);
+    ojr_set_state_r(&s1, ck, sizeof(ck));
+    for (j = 0; j < 255; ++j) ojr_next64_r(&s1);
+    if (11520 != ojr_next64_r(&s1)) return 7;
+
+    make_state(ck, OJR_ENGINE_PCG64, pcg, 4, 8);
+    if (0 == ojr_set_state_r(&s1, ck, sizeof(ck))) {
+        for (j = 0; j < 254; ++j) ojr_next64_r(&s1);
+        if (0x1304AA46C9853D39ull != ojr_next64_r(&s1)) return 8;
+        if (0x86B1DA1D72062B68ull != ojr_next64_r(&s1)) return 8;
+    }
+    make_state(ck, OJR_ENGINE_CHACHA20, cc, 12, 4);
+    ojr_set_state_r(&s1, ck, sizeof(ck));
+    for (j = 0; j < 512; ++j) a[j] = ojr_next32_r(&s1);
+    if (0xE4E7F110 != a[511] || 0x15593BD1 != a[510]) return 9;
+    if (0x1FDD0F50 != a[509] || 0xC47120A3 != a[508]) return 9;
+
+    // Byte seeds: the same bytes give the same output, and any change,
+    // even a trailing zero, gives different output.
+    ojr_new(&s1, 1);
+    ojr_new(&s2, 2);
+    ojr_seed_bytes_r(&s1, "The quick brown fox jumps", 25);
+    ojr_seed_bytes_r(&s2, "The quick brown fox jumps", 25);
+    for (j = 0; j < 512; ++j) if (ojr_next32_r(&s1) != ojr_next32_r(&s2)) return 10;
+    ojr_seed_bytes_r(&s1, "The quick brown fox jumps", 25);
+    ojr_seed_bytes_r(&s2, "The quick brown fox jumps", 26);
+    for (j = 0; j < 512; ++j) if (ojr_next32_r(&s1) == ojr_next32_r(&s2)) return 11;
+    ojr_seed_bytes_r(&s1, "The quick brown fox jumps", 25);
+    ojr_seed_bytes_r(&s2, "The quick brown fox jumpt", 25);
+    for (j = 0; j < 512; ++j) if (ojr_next32_r(&s1) == ojr_next32_r(&s2)) return 12;
+    return 0;
+}
+
+// Read four words of generator <rs>, or of the default one through the
+// plain functions if 0, in a child process.
+static int child_words(ojr_state *rs, uint64_t *out) {
+    int fd[2], st;
+    pid_t pid;
+    uint64_t w[4];
+
+    if (0 != pipe(fd)) return -1;
+    if (0 == (pid = fork())) {
+        for (int i = 0; i < 4; ++i) w[i] = rs ? ojr_next64_r(rs) : ojr_next64();
+        if (sizeof(w) != write(fd[1], w, sizeof(w))) _exit(1);
+        _exit(0);
+    }
+    close(fd[1]);
+    st = (sizeof(w) == read(fd[0], out, sizeof(w))) ? 0 : -1;
+    close(fd[0]);
+    waitpid(pid, 0, 0);
+    return st;
+}
+
+// Children and parent all differ if <same> is 0, else all agree.
+static int fork_words(ojr_state *rs, int same) {
+    uint64_t a[4], b[4], c[4];
+
+    if (child_words(rs, a) || child_words(rs, b)) return 1;
+    for (int i = 0; i < 4; ++i) c[i] = rs ? ojr_next64_r(rs) : ojr_next64();
+    if (same) {
+        return 0 != memcmp(a, b, sizeof(a)) || 0 != memcmp(a, c, sizeof(a));
+    }
+    return 0 == memcmp(a, b, sizeof(a)) || 0 == memcmp(a, c, sizeof(a));
+}
+
+/* Forked children reseed the default generator if it was seeded from
+ * entropy, and keep the sequence if it was given a seed or a saved state,
+ * however it was done and however they reach it.
+ */
+int fork_test(void) {
+    unsigned char buf[OJR_STATE_SIZE];
+    ojr_state *rs;
+
+    oj_init_library(0);
+    ojr_next64();
+    if (fork_words(0, 0)) return 1;
+    rs = ojr_default_state();
+    if (fork_words(rs, 0)) return 2;
+
+    ojr_seed(8642);
+    ojr_next64();
+    if (fork_words(0, 1) || fork_words(rs, 1)) return 3;
+    ojr_seed_r(rs, 0);
+    if (fork_words(rs, 0)) return 4;
+    ojr_seed_r(rs, 97531);
+    if (fork_words(rs, 1) || fork_words(0, 1)) return 5;
+
+    ojr_seed_r(rs, 0);
+    ojr_seed_bytes_r(rs, "fork", 4);
+    if (fork_words(rs, 1)) return 6;
+    ojr_seed_r(rs, 0);
+    ojr_get_state_r(rs, buf, sizeof(buf));
+    ojr_set_state_r(rs, buf, sizeof(buf));
+    if (fork_words(rs, 1)) return 7;
+
+    oj_init_library(0);
+    return 0;
+}
+
+/* Philox matches the Random123 known-answer vectors, and deals by index
+ * are reproducible, independent of order, and evenly spread.
+ */
+int philox_test(int count) {
+    int i, j;
+    uint32_t out[4];
+    uint32_t ctr[3][4] = {
+        { 0, 0, 0, 0 },
+        { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF },
+        { 0x243F6A88, 0x85A308D3, 0x13198A2E, 0x03707344 }
+    };
+    uint32_t key[3][2] = {
+        { 0, 0 }, { 0xFFFFFFFF, 0xFFFFFFFF }, { 0xA4093822, 0x299F31D0 }
+    };
+    uint32_t kat[3][4] = {
+        { 0x6627E8D5, 0xE169C58D, 0xBC57AC4C, 0x9B00DBD8 },
+        { 0x408F276D, 0x41C83B0E, 0xA20BC7C6, 0x6D5451FD },
+        { 0xD16CFE09, 0x94FDCCEB, 0x5001E420, 0x24126EA1 }
+    };
+    oj_card buf1[54], buf2[54];
+    oj_cardlist d1, d2;
+    struct buckets *bp;
+
+    for (i = 0; i < 3; ++i) {
+        ojr_philox(ctr[i], key[i], out);
+        if (! allequal(out, kat[i], 4)) return 1;
+    }
+    ojl_new(&d1, buf1, 54);
+    ojl_new(&d2, buf2, 54);
+    for (i = 0; i < 100; ++i) {
+        ojl_fill_shuffled_at(&d1, OJD_STANDARD, 0xC0FFEE, 1000 - i);
+        ojl_fill_shuffled_at(&d2, OJD_STANDARD, 0xC0FFEE, i);
+        ojl_fill_shuffled_at(&d2, OJD_STANDARD, 0xC0FFEE, 1000 - i);
+        if (! ojl_equal(&d1, &d2)) return 2;
+        ojl_fill_shuffled_at(&d2, OJD_STANDARD, 0xC0FFEF, 1000 - i);
+        if (ojl_equal(&d1, &d2)) return 3;
+    }
+    bp = create_buckets(52);
+    for (i = 0; i < count; ++i) {
+        ojl_fill_shuffled_at(&d1, OJD_STANDARD, 12345, i);
+        for (j = 0; j < 52; j += 13) add_value(bp, OJL_GET(&d1, j));
+    }
+    calculate_stats(bp);
+    if ((bp->stddev / bp->mean) > 0.005) return 4;
+    if (bp->maxz > 4.0) return 5;
+    free_buckets(bp);
+    return 0;
+}
+
 /* Test that ojr_rand() gives a balanced random number within limits. Fill
  * buckets with a few million of them and measure the variance from the
  * expected value.
@@ -115,6 +545,47 @@ int balance_test(int count) {
     return 0;
 }
 
+/* Same for the full-width ojr_rand32() and ojr_rand64(), with limits
+ * where a plain modulus would be far out of balance: three times a power
+ * of two, split into 24 buckets. ojr_rand_many() must give the same values
+ * as one at a time.
+ */
+int wide_test(int count) {
+    int i, j;
+    uint64_t v, lim[3] = { 24 * 1000003ull, 3ull << 30, 3ull << 62 };
+    uint32_t many[100], nv[3] = { 52, 416, 3u << 30 };
+    ojr_state s1, s2;
+    struct buckets *bp;
+
+    fprintf(stderr, "Wide test count = %d...\n", count);
+    for (i = 0; i < 3; ++i) {
+        bp = create_buckets(24);
+
+        for (j = 0; j < count; ++j) {
+            if (lim[i] >> 32) v = ojr_rand64(lim[i]);
+            else v = ojr_rand32((uint32_t)lim[i]);
+            if (v >= lim[i]) return 1;
+            add_value(bp, (int)(v / (lim[i] / 24)));
+        }
+        calculate_stats(bp);
+        fprintf(stderr, "%3d buckets: mean = %10.2f, stddev = %7.2f (%4.2f %%), maxz = %4.2f\n",
+            24, bp->mean, bp->stddev, (100.0 * bp->stddev) / bp->mean, bp->maxz);
+
+        if ((bp->stddev / bp->mean) > 0.005) return 2;
+        if (bp->maxz > 4.0) return 3;
+        free_buckets(bp);
+    }
+    for (i = 0; i < 3; ++i) {
+        ojr_new(&s1, 31337 + i);
+        ojr_new(&s2, 31337 + i);
+        ojr_rand_many_r(&s1, nv[i], many, 100);
+        for (j = 0; j < 100; ++j) {
+            if (many[j] != ojr_rand32_r(&s2, nv[i])) return 4;
+        }
+    }
+    return 0;
+}
+
 /* Myrvold and Ruskey linear-time permutation rank algorithm.
  */
 #define SWAP(a,b) do{t=(a);(a)=(b);(b)=t;}while(0)
@@ -129,7 +600,7 @@ int _mr_rank1(int n, int *vec, int *inv) {
     return s + n * _mr_rank1(n-1, vec, inv);
 }
 
-int get_rank(oj_cardlist_t *sp) {
+int get_rank(oj_cardlist *sp) {
     int i, vec[10], inv[10], n = sp->length;
     assert(n <= 10);
 
@@ -141,11 +612,10 @@ int get_rank(oj_cardlist_t *sp) {
 }
 
 int shuffle_test(int count) {
-    int i, j, r, h, b, dbuf[54], hbuf[20];
-    char cbuf[64];
-    oj_cardlist_t deck, hand;
+    int i, r, b;
+    oj_card dbuf[54], hbuf[20];
+    oj_cardlist deck, hand;
     struct buckets *bp[5];
-    oj_combiner_t comb;
 
     ojl_new(&deck, dbuf, 52);
     ojl_new(&hand, hbuf, 20);
@@ -197,12 +667,96 @@ int shuffle_test(int count) {
     return 0;
 }
 
+/* Batched shuffles: all 120 orders of five cards equally likely, and
+ * every card equally likely at the ends and middle of a deck. Indices
+ * from ojr_rand_descending() stay under their bounds even when the bounds
+ * are too big to share a draw.
+ */
+// Library internal, from prng.c.
+extern int _ojr_batch_group(uint32_t, int, int, uint64_t *);
+
+/* Each group of batched indices must have a product of bounds no more
+ * than 2^56, and be as long as it can be under that. Multiply carefully
+ * so that the check itself can't overflow.
+ */
+static int check_groups(uint32_t n, int count) {
+    const uint64_t max = 1ull << 56;
+    uint64_t prod, p;
+    int j, k, m;
+
+    for (m = 0; m < count; m += k) {
+        k = _ojr_batch_group(n, m, count, &prod);
+        if (k < 1 || m + k > count) return 1;
+        for (p = 1, j = 0; j < k; ++j) {
+            if (p > max / (n - m - j)) return 1;
+            p *= n - m - j;
+        }
+        if (p != prod) return 1;
+        if (m + k < count && p <= max / (n - m - k)) return 1;
+    }
+    return 0;
+}
+
+int batched_test(int count) {
+    int i, j, b;
+    uint32_t idx[40];
+    oj_card dbuf[54], hbuf[20];
+    oj_cardlist deck, hand;
+    struct buckets *bp[3];
+
+    ojl_new(&deck, dbuf, 52);
+    ojl_new(&hand, hbuf, 20);
+    fprintf(stderr, "Batched shuffle test count = %d...\n", count);
+
+    ojl_fill(&hand, 5, OJD_STANDARD);
+    bp[0] = create_buckets(120);
+    for (i = 0; i < count; ++i) {
+        ojl_shuffle_batched(&hand);
+        add_value(bp[0], get_rank(&hand));
+    }
+    calculate_stats(bp[0]);
+    fprintf(stderr, "%3d buckets: mean = %10.2f, stddev = %7.2f (%4.2f %%), maxz = %4.2f\n",
+        120, bp[0]->mean, bp[0]->stddev, (100.0 * bp[0]->stddev) / bp[0]->mean, bp[0]->maxz);
+
+    if ((bp[0]->stddev / bp[0]->mean) > 0.01) return 1;
+    if (bp[0]->maxz > 4.5) return 2;
+    free_buckets(bp[0]);
+
+    for (b = 0; b < 3; ++b) bp[b] = create_buckets(52);
+    for (i = 0; i < count; ++i) {
+        ojl_fill_shuffled_batched(&deck, OJD_STANDARD);
+        add_value(bp[0], OJL_GET(&deck, 0));
+        add_value(bp[1], OJL_GET(&deck, 26));
+        add_value(bp[2], OJL_GET(&deck, 51));
+    }
+    for (b = 0; b < 3; ++b) {
+        calculate_stats(bp[b]);
+        fprintf(stderr, "%3d buckets: mean = %10.2f, stddev = %7.2f (%4.2f %%), maxz = %4.2f\n",
+            52, bp[b]->mean, bp[b]->stddev, (100.0 * bp[b]->stddev) / bp[b]->mean, bp[b]->maxz);
+
+        if ((bp[b]->stddev / bp[b]->mean) > 0.01) return 3;
+        if (bp[b]->maxz > 4.5) return 4;
+        free_buckets(bp[b]);
+    }
+    for (i = 0; i < 1000; ++i) {
+        ojr_rand_descending(4000000000u - i, idx, 40);
+        for (j = 0; j < 40; ++j) if (idx[j] >= 4000000000u - i - j) return 5;
+        ojr_rand_descending(45, idx, 40);
+        for (j = 0; j < 40; ++j) if (idx[j] >= (uint32_t)(45 - j)) return 6;
+    }
+    // An unchecked product overflowed for n = 1628, among many others.
+    if (check_groups(1628, 1628)) return 7;
+    for (i = 1; i < 20000; ++i) if (check_groups(i, i)) return 7;
+    for (i = 0; i < 1000; ++i) if (check_groups(4000000000u - i, 1000)) return 7;
+    return 0;
+}
+
 int montecarlo_test(int count) {
-    int i, j, r, dbuf[20], hbuf[20];
-    char cbuf[64];
-    oj_cardlist_t deck, hand;
+    int r;
+    oj_card dbuf[20], hbuf[20];
+    oj_cardlist deck, hand;
     struct buckets *bp;
-    oj_combiner_t comb;
+    oj_combiner comb;
 
     ojl_new(&deck, dbuf, 20);
     ojl_new(&hand, hbuf, 20);
@@ -215,7 +769,7 @@ int montecarlo_test(int count) {
     bp = create_buckets(20);
 
     while (ojc_next_random(&comb)) {
-        r = (int)ojc_colex_rank(&hand, &comb);
+        r = (int)ojc_colex_rank(&comb, &hand);
         add_value(bp, r);
     }
     calculate_stats(bp);
@@ -239,7 +793,7 @@ void feed_dieharder(void) {
         for (i = 0; i < 100; ++i) {
             buf[i] = ojr_next32();
         }
-        write(STDOUT_FILENO, buf, sizeof(buf));
+        if (write(STDOUT_FILENO, buf, sizeof(buf)) < 0) return;
     }
 }
 
@@ -249,12 +803,39 @@ int main(int argc, char *argv[]) {
     failed |= (r = seed_test());
     fprintf(stderr, "Seed test %sed.\n", (r ? "fail" : "pass"));
 
+    failed |= (r = state_test());
+    fprintf(stderr, "State test %sed.\n", (r ? "fail" : "pass"));
+
+    failed |= (r = jump_test());
+    fprintf(stderr, "Jump test %sed.\n", (r ? "fail" : "pass"));
+
+    failed |= (r = engine_test());
+    fprintf(stderr, "Engine test %sed.\n", (r ? "fail" : "pass"));
+
+    failed |= (r = backend_test());
+    fprintf(stderr, "Backend test %sed.\n", (r ? "fail" : "pass"));
+
+    failed |= (r = save_test());
+    fprintf(stderr, "Save test %sed.\n", (r ? "fail" : "pass"));
+
+    failed |= (r = fork_test());
+    fprintf(stderr, "Fork test %sed.\n", (r ? "fail" : "pass"));
+
+    failed |= (r = philox_test(1000000));
+    fprintf(stderr, "Philox test %sed.\n", (r ? "fail" : "pass"));
+
     failed |= (r = balance_test(10000000));
     fprintf(stderr, "Balance test %sed.\n", (r ? "fail" : "pass"));
 
+    failed |= (r = wide_test(3000000));
+    fprintf(stderr, "Wide test %sed.\n", (r ? "fail" : "pass"));
+
     failed |= (r = shuffle_test(10000000));
     fprintf(stderr, "Shuffle test %sed.\n", (r ? "fail" : "pass"));
 
+    failed |= (r = batched_test(2000000));
+    fprintf(stderr, "Batched shuffle test %sed.\n", (r ? "fail" : "pass"));
+
     failed |= (r = montecarlo_test(10000000));
     fprintf(stderr, "Monte Carlo test %sed.\n", (r ? "fail" : "pass"));
 
@@ -0,0 +1,58 @@
+/* OneJoker card library <http://lcrocker.github.io/onejoker/cardlib>
+ *
+ * To the extent possibile under law, Lee Daniel Crocker has waived all
+ * copyright and related or neighboring rights to this work.
+ * <http://creativecommons.org/publicdomain/zero/1.0/>
+ *
+ * Build the direct 7-card evaluator table if needed, then check it
+ * against the LDC evaluator. Usage: t_table7 [file]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <string.h>
+#include <assert.h>
+
+#include "ojcardlib.h"
+
+int main(int argc, char *argv[]) {
+    int r, v, count = 10000000;
+    char *path = "ojp7.tbl";
+    oj_card dbuf[52], hbuf[7];
+    oj_cardlist deck, hand;
+    oj_combiner cmb;
+
+    if (argc > 1) path = argv[1];
+    if (0 != ojp_table7_load(path)) {
+        fprintf(stderr, "Building %s...\n", path);
+        r = ojp_table7_build(path);
+        if (0 == r) r = ojp_table7_load(path);
+        if (0 != r) {
+            fprintf(stderr, "Could not build table (code = %d).\n", r);
+            return EXIT_FAILURE;
+        }
+    }
+    ojl_new(&deck, dbuf, 52);
+    ojl_fill(&deck, 52, OJD_STANDARD);
+    ojl_new(&hand, hbuf, 7);
+    ojc_new(&cmb, &deck, &hand, 7, (int64_t)count);
+
+    r = 0;
+    while (0 == r && ojc_next_random(&cmb)) {
+        ojp_set_engine(OJP_ENGINE_LDC);
+        v = ojp_eval7(&hand);
+        ojp_set_engine(OJP_ENGINE_TABLE7);
+        if (v != ojp_eval7(&hand)) r = 1;
+    }
+    ojp_table7_unload();
+    if (OJP_ENGINE_LDC != ojp_get_engine()) r = 2;
+
+    fprintf(stderr, "7-card table test ");
+    if (r) {
+        fprintf(stderr, "failed (code = %d).\n", r);
+    } else {
+        fprintf(stderr, "passed %d random hands.\n", count);
+    }
+    return r ? EXIT_FAILURE : EXIT_SUCCESS;
+}